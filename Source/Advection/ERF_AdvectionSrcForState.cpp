@@ -92,6 +92,96 @@ AdvectionSrcForRho (const Box& bx,
     }
 }
 
+/**
+ * Function for computing the advective tendency for rho and (rho theta) together with the
+ * external sources in a single sweep over the cells.  This is only valid without terrain,
+ * with unit map factors and with second-order centered advection in all directions, in
+ * which case the contravariant momentum is just the momentum itself and the face values of
+ * theta are simple averages.  The cell kernel builds the flux divergence directly from the
+ * momenta and theta rather than re-reading the fluxes, so the face kernels only have to
+ * write what is needed later (avg_mom for the fast integrator and the fluxes for refluxing).
+ *
+ * @param[in] bx box over which the scalars are updated
+ * @param[out] advectionSrc tendency for the scalar update equation
+ * @param[in] rho_u x-component of momentum
+ * @param[in] rho_v y-component of momentum
+ * @param[in] rho_w z-component of momentum
+ * @param[in] cell_prim primitive form of scalar variables, here only potential temperature theta
+ * @param[in] source_arr external sources for the conserved variables
+ * @param[out] avg_xmom x-component of time-averaged momentum defined in this routine
+ * @param[out] avg_ymom y-component of time-averaged momentum defined in this routine
+ * @param[out] avg_zmom z-component of time-averaged momentum defined in this routine
+ * @param[in] cellSizeInv inverse of the mesh spacing
+ * @param[out] flx_arr fluxes of rho and (rho theta)
+ * @param[in] const_rho if true the density is not advected
+ */
+
+void
+AdvectionSrcForRhoThetaFused_N (const Box& bx,
+                                const Array4<Real>& advectionSrc,
+                                const Array4<const Real>& rho_u,
+                                const Array4<const Real>& rho_v,
+                                const Array4<const Real>& rho_w,
+                                const Array4<const Real>& cell_prim,
+                                const Array4<const Real>& source_arr,
+                                const Array4<      Real>& avg_xmom,
+                                const Array4<      Real>& avg_ymom,
+                                const Array4<      Real>& avg_zmom,
+                                const GpuArray<Real, AMREX_SPACEDIM>& cellSizeInv,
+                                const GpuArray<const Array4<Real>, AMREX_SPACEDIM>& flx_arr,
+                                const bool const_rho)
+{
+    BL_PROFILE_VAR("AdvectionSrcForRhoThetaFused_N", AdvectionSrcForRhoThetaFused_N);
+    auto dxInv = cellSizeInv[0], dyInv = cellSizeInv[1], dzInv = cellSizeInv[2];
+
+    const Box xbx = surroundingNodes(bx,0);
+    const Box ybx = surroundingNodes(bx,1);
+    const Box zbx = surroundingNodes(bx,2);
+
+    ParallelFor(xbx, ybx, zbx,
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        avg_xmom(i,j,k)       = rho_u(i,j,k);
+        (flx_arr[0])(i,j,k,0) = rho_u(i,j,k);
+        (flx_arr[0])(i,j,k,1) = rho_u(i,j,k) * 0.5 * (cell_prim(i,j,k,PrimTheta_comp) + cell_prim(i-1,j,k,PrimTheta_comp));
+    },
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        avg_ymom(i,j,k)       = rho_v(i,j,k);
+        (flx_arr[1])(i,j,k,0) = rho_v(i,j,k);
+        (flx_arr[1])(i,j,k,1) = rho_v(i,j,k) * 0.5 * (cell_prim(i,j,k,PrimTheta_comp) + cell_prim(i,j-1,k,PrimTheta_comp));
+    },
+    [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        avg_zmom(i,j,k)       = rho_w(i,j,k);
+        (flx_arr[2])(i,j,k,0) = rho_w(i,j,k);
+        (flx_arr[2])(i,j,k,1) = rho_w(i,j,k) * 0.5 * (cell_prim(i,j,k,PrimTheta_comp) + cell_prim(i,j,k-1,PrimTheta_comp));
+    });
+
+    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        Real th_c = cell_prim(i,j,k,PrimTheta_comp);
+
+        Real xflux_lo = rho_u(i  ,j,k); Real xflux_hi = rho_u(i+1,j,k);
+        Real yflux_lo = rho_v(i,j  ,k); Real yflux_hi = rho_v(i,j+1,k);
+        Real zflux_lo = rho_w(i,j,k  ); Real zflux_hi = rho_w(i,j,k+1);
+
+        Real rho_src = (xflux_hi - xflux_lo) * dxInv
+                     + (yflux_hi - yflux_lo) * dyInv
+                     + (zflux_hi - zflux_lo) * dzInv;
+
+        Real rt_src  = ( xflux_hi * (cell_prim(i+1,j,k,PrimTheta_comp) + th_c)
+                        -xflux_lo * (cell_prim(i-1,j,k,PrimTheta_comp) + th_c) ) * 0.5 * dxInv
+                     + ( yflux_hi * (cell_prim(i,j+1,k,PrimTheta_comp) + th_c)
+                        -yflux_lo * (cell_prim(i,j-1,k,PrimTheta_comp) + th_c) ) * 0.5 * dyInv
+                     + ( zflux_hi * (cell_prim(i,j,k+1,PrimTheta_comp) + th_c)
+                        -zflux_lo * (cell_prim(i,j,k-1,PrimTheta_comp) + th_c) ) * 0.5 * dzInv;
+
+        advectionSrc(i,j,k,Rho_comp)      = ((const_rho) ? 0.0 : -rho_src) + source_arr(i,j,k,Rho_comp);
+        advectionSrc(i,j,k,RhoTheta_comp) = -rt_src + source_arr(i,j,k,RhoTheta_comp);
+    });
+}
+
 /**
  * Function for computing the advective tendency for the update equations for all scalars other than rho and (rho theta)
  * This routine has explicit expressions for all cases (terrain or not) when
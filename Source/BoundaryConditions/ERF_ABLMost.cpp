@@ -26,6 +26,15 @@ ABLMost::update_fluxes (const int& lev,
     // Compute plane averages for all vars (regardless of flux type)
     m_ma.compute_averages(lev);
 
+    most_solver_params sparams;
+    sparams.max_iters   = max_iters;
+    sparams.fixed_iters = m_fixed_iters;
+    sparams.warm_start  = m_warm_start;
+
+    m_iter_sum   = 0;
+    m_iter_cells = 0;
+    Real t_start = (m_report_iters) ? ParallelDescriptor::second() : 0.0;
+
     // ***************************************************************
     // Iterate the fluxes if moeng type
     // First iterate over land -- the only model for surface roughness
@@ -37,7 +46,7 @@ ABLMost::update_fluxes (const int& lev,
         if (theta_type == ThetaCalcType::HEAT_FLUX) {
             if (rough_type_land == RoughCalcType::CONSTANT) {
                 surface_flux most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_land");
             }
@@ -45,14 +54,14 @@ ABLMost::update_fluxes (const int& lev,
             update_surf_temp(time);
             if (rough_type_land == RoughCalcType::CONSTANT) {
                 surface_temp most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_land");
             }
         } else if (theta_type == ThetaCalcType::ADIABATIC) {
             if (rough_type_land == RoughCalcType::CONSTANT) {
                 adiabatic most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_land");
             }
@@ -72,16 +81,16 @@ ABLMost::update_fluxes (const int& lev,
         if (theta_type == ThetaCalcType::HEAT_FLUX) {
             if (rough_type_sea == RoughCalcType::CHARNOCK) {
                 surface_flux_charnock most_flux(m_ma.get_zref(), surf_temp_flux, cnk_a, cnk_visc);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::MODIFIED_CHARNOCK) {
                 surface_flux_mod_charnock most_flux(m_ma.get_zref(), surf_temp_flux, depth);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::DONELAN) {
                 surface_flux_donelan most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::WAVE_COUPLED) {
                 surface_flux_wave_coupled most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_sea");
             }
@@ -90,16 +99,16 @@ ABLMost::update_fluxes (const int& lev,
             update_surf_temp(time);
             if (rough_type_sea == RoughCalcType::CHARNOCK) {
                 surface_temp_charnock most_flux(m_ma.get_zref(), surf_temp_flux, cnk_a, cnk_visc);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::MODIFIED_CHARNOCK) {
                 surface_temp_mod_charnock most_flux(m_ma.get_zref(), surf_temp_flux, depth);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::DONELAN) {
                 surface_temp_donelan most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::WAVE_COUPLED) {
                 surface_temp_wave_coupled most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_sea");
             }
@@ -107,16 +116,16 @@ ABLMost::update_fluxes (const int& lev,
         } else if (theta_type == ThetaCalcType::ADIABATIC) {
             if (rough_type_sea == RoughCalcType::CHARNOCK) {
                 adiabatic_charnock most_flux(m_ma.get_zref(), surf_temp_flux, cnk_a, cnk_visc);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::MODIFIED_CHARNOCK) {
                 adiabatic_mod_charnock most_flux(m_ma.get_zref(), surf_temp_flux, depth);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::DONELAN) {
                 adiabatic_donelan most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else if (rough_type_sea == RoughCalcType::WAVE_COUPLED) {
                 adiabatic_wave_coupled most_flux(m_ma.get_zref(), surf_temp_flux);
-                compute_fluxes(lev, max_iters, most_flux, is_land);
+                compute_fluxes(lev, sparams, most_flux, is_land);
             } else {
                 amrex::Abort("Unknown value for rough_type_sea");
             }
@@ -126,6 +135,17 @@ ABLMost::update_fluxes (const int& lev,
 
     } // MOENG -- SEA
 
+    if (m_report_iters && (flux_type == FluxCalcType::MOENG ||
+                           flux_type == FluxCalcType::ROTATE)) {
+        Long counts[2] = {m_iter_sum, m_iter_cells};
+        ParallelDescriptor::ReduceLongSum(counts, 2, ParallelDescriptor::IOProcessorNumber());
+        Real t_solve = ParallelDescriptor::second() - t_start;
+        ParallelDescriptor::ReduceRealMax(t_solve, ParallelDescriptor::IOProcessorNumber());
+        Real avg_iters = (counts[1] > 0) ? Real(counts[0]) / Real(counts[1]) : 0.0;
+        Print() << "MOST solve at level " << lev << ": " << counts[1] << " columns, "
+                << avg_iters << " iterations on average, " << t_solve << " seconds" << std::endl;
+    }
+
     if (flux_type == FluxCalcType::CUSTOM) {
         u_star[lev]->setVal(custom_ustar);
         t_star[lev]->setVal(custom_tstar);
@@ -137,13 +157,14 @@ ABLMost::update_fluxes (const int& lev,
  * Function to compute the fluxes (u^star and t^star) for Monin Obukhov similarity theory
  *
  * @param[in] lev Current level
- * @param[in] max_iters maximum iterations to use
+ * @param[in] sparams iteration controls (iteration cap, fixed count, warm start)
  * @param[in] most_flux structure to iteratively compute ustar and tstar
+ * @param[in] is_land only update cells with this land mask value
  */
 template <typename FluxIter>
 void
 ABLMost::compute_fluxes (const int& lev,
-                         const int& max_iters,
+                         const most_solver_params& sparams,
                          const FluxIter& most_flux,
                          bool is_land)
 {
@@ -153,6 +174,11 @@ ABLMost::compute_fluxes (const int& lev,
     const auto *const tvm_ptr = m_ma.get_average(lev,4); // virtual potential temperature
     const auto *const umm_ptr = m_ma.get_average(lev,5); // horizontal velocity magnitude
 
+    // Iteration counts, only accumulated when reporting
+    ReduceOps<ReduceOpSum, ReduceOpSum> reduce_op;
+    ReduceData<Long, Long> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
     for (MFIter mfi(*u_star[lev]); mfi.isValid(); ++mfi)
     {
         Box gtbx = mfi.growntilebox();
@@ -183,19 +209,41 @@ ABLMost::compute_fluxes (const int& lev,
         auto lmask_arr    = (m_lmask_lev[lev][0])    ? m_lmask_lev[lev][0]->array(mfi) :
                                                        Array4<int> {};
 
-        ParallelFor(gtbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        // Returns the number of iterations taken, or -1 if the cell is masked out
+        auto solve = [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept -> int
         {
             if (( is_land && lmask_arr(i,j,k) == 1) ||
                 (!is_land && lmask_arr(i,j,k) == 0))
             {
-                most_flux.iterate_flux(i, j, k, max_iters,
-                                       z0_arr, umm_arr, tm_arr, tvm_arr, qvm_arr,
-                                       u_star_arr, w_star_arr,  // to be updated
-                                       t_star_arr, q_star_arr,  // to be updated
-                                       t_surf_arr, olen_arr,    // to be updated
-                                       pblh_arr, Hwave_arr, Lwave_arr, eta_arr);
+                return most_flux.iterate_flux(i, j, k, sparams,
+                                              z0_arr, umm_arr, tm_arr, tvm_arr, qvm_arr,
+                                              u_star_arr, w_star_arr,  // to be updated
+                                              t_star_arr, q_star_arr,  // to be updated
+                                              t_surf_arr, olen_arr,    // to be updated
+                                              pblh_arr, Hwave_arr, Lwave_arr, eta_arr);
             }
-        });
+            return -1;
+        };
+
+        if (m_report_iters) {
+            reduce_op.eval(gtbx, reduce_data,
+            [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept -> ReduceTuple
+            {
+                int iter = solve(i,j,k);
+                return (iter >= 0) ? ReduceTuple{Long(iter), Long(1)} : ReduceTuple{0, 0};
+            });
+        } else {
+            ParallelFor(gtbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                solve(i,j,k);
+            });
+        }
+    }
+
+    if (m_report_iters) {
+        ReduceTuple hv = reduce_data.value(reduce_op);
+        m_iter_sum   += amrex::get<0>(hv);
+        m_iter_cells += amrex::get<1>(hv);
     }
 }
 
@@ -225,8 +273,10 @@ ABLMost::impose_most_bcs (const int& lev,
                           MultiFab* z_phys)
 {
     const int klo = 0;
+    const bool compact = ( m_eddyDiffs_lev[lev] &&
+                           m_eddyDiffs_lev[lev]->nComp() == EddyDiff::NumCompact );
     if (flux_type == FluxCalcType::MOENG) {
-        moeng_flux flux_comp(klo);
+        moeng_flux flux_comp(klo, compact, m_inv_Pr_t[lev], m_inv_Sc_t[lev]);
         compute_most_bcs(lev, mfs,
                          xxmom_flux,
                          yymom_flux,
@@ -238,7 +288,7 @@ ABLMost::impose_most_bcs (const int& lev,
                          xqv_flux, yqv_flux, zqv_flux,
                          z_phys, flux_comp);
     } else if (flux_type == FluxCalcType::DONELAN) {
-        donelan_flux flux_comp(klo);
+        donelan_flux flux_comp(klo, compact, m_inv_Pr_t[lev], m_inv_Sc_t[lev]);
         compute_most_bcs(lev, mfs,
                          xxmom_flux,
                          yymom_flux,
@@ -262,7 +312,7 @@ ABLMost::impose_most_bcs (const int& lev,
                          xqv_flux, yqv_flux, zqv_flux,
                          z_phys, flux_comp);
     } else {
-        custom_flux flux_comp(klo);
+        custom_flux flux_comp(klo, compact, m_inv_Pr_t[lev], m_inv_Sc_t[lev]);
         compute_most_bcs(lev, mfs,
                          xxmom_flux,
                          yymom_flux,
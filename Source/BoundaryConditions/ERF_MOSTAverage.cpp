@@ -308,6 +308,8 @@ MOSTAverage::set_plane_normalization ()
     // Cells per plane and temp avg storage
     m_ncell_plane.resize(m_maxlev);
     m_plane_average.resize(m_maxlev);
+    m_plane_sum.resize(m_maxlev);
+    m_plane_avg_d.resize(m_maxlev);
 
     for (int lev(0); lev < m_maxlev; lev++) {
         // Num components, plane avg, cells per plane
@@ -318,6 +320,8 @@ MOSTAverage::set_plane_normalization ()
         Box domain = m_geom[lev].Domain();
         m_ncell_plane[lev].resize(m_navg);
         m_plane_average[lev].resize(m_navg);
+        m_plane_sum[lev].resize(m_navg);
+        m_plane_avg_d[lev].resize(m_navg);
         for (int iavg(0); iavg < m_navg; ++iavg) {
             // Convert domain to current index type
             IndexType ixt = m_averages[lev][iavg]->boxArray().ixType();
@@ -668,6 +672,10 @@ MOSTAverage::compute_averages (int lev)
 /**
  * Function to compute average over a plane.
  *
+ * All of the averages (U, V, T, Qv, Tv, Umag) are accumulated in a single
+ * kernel per tile into a persistent device buffer, followed by a single
+ * reduction across ranks.
+ *
  * @param[in] lev Current level
  */
 void
@@ -701,13 +709,13 @@ MOSTAverage::compute_plane_averages (int lev)
         d_fact_old = 0.0;
     }
 
-    // GPU array to accumulate averages into
-    Gpu::DeviceVector<Real> pavg(plane_average.size(), 0.0);
-    Real* plane_avg = pavg.data();
-
-    // Vectors for normalization and buffer storage
-    Vector<Real> denom(plane_average.size(),0.0);
-    Vector<Real> val_old(plane_average.size(),0.0);
+    // Persistent GPU array to accumulate averages into
+    AMREX_ASSERT(m_navg == 6);
+    Real* plane_avg = m_plane_avg_d[lev].data();
+    ParallelFor(m_navg, [=] AMREX_GPU_DEVICE (int n) noexcept
+    {
+        plane_avg[n] = 0.0;
+    });
 
     //
     //----------------------------------------------------------
@@ -721,230 +729,156 @@ MOSTAverage::compute_plane_averages (int lev)
         if (geom.isPeriodic(idim)) is_per[idim] = 1;
     }
 
-    // Averages for U,V,T,Qv (not Qr or W)
-    for (int imf(0); imf < 4; ++imf) {
+    const Real Vsg = m_Vsg[lev];
 
-        // Continue if no valid Qv pointer
-        if (!fields[imf]) continue;
-
-        denom[imf]   = 1.0 / (Real)ncell_plane[imf];
-        val_old[imf] = plane_average[imf]*d_fact_old;
+    // Single MFIter over CC data
+    int iavg_cc = m_navg - 1;
 
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-        for (MFIter mfi(*fields[imf], TileNoZ()); mfi.isValid(); ++mfi) {
-            Box vbx = mfi.validbox(); // This is the grid (not tile)
-            Box pbx = mfi.tilebox();  // This is the tile (not grid)
-            pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            // Avoid double counting nodal data by changing the high end when we are
-            //     at the high side of the grid (not just of the tile)
-            IndexType ixt = averages[imf]->boxArray().ixType();
-            for (int idim(0); idim < AMREX_SPACEDIM-1; ++idim) {
-                if ( ixt.nodeCentered(idim)  && (pbx.bigEnd(idim) == vbx.bigEnd(idim)) ) {
-                    int dom_hi = domain.bigEnd(idim)+1;
-                    if (pbx.bigEnd(idim) < dom_hi || is_per[idim]) {
-                        pbx.growHi(idim,-1);
-                    }
+    for (MFIter mfi(*averages[iavg_cc], TileNoZ()); mfi.isValid(); ++mfi)
+    {
+        // Tiles for the CC and face centered data.
+        // Avoid double counting nodal data by changing the high end when we are
+        //     at the high side of the grid (not just of the tile)
+        Box cbx = mfi.tilebox(); cbx.setSmall(2,0); cbx.setBig(2,0);
+        Box ubx = mfi.tilebox(IntVect(1,0,0)); ubx.setSmall(2,0); ubx.setBig(2,0);
+        Box vbx = mfi.tilebox(IntVect(0,1,0)); vbx.setSmall(2,0); vbx.setBig(2,0);
+        for (int idim(0); idim < AMREX_SPACEDIM-1; ++idim) {
+            Box& fbx = (idim == 0) ? ubx : vbx;
+            if (fbx.bigEnd(idim) == mfi.validbox().bigEnd(idim)+1) {
+                int dom_hi = domain.bigEnd(idim)+1;
+                if (fbx.bigEnd(idim) < dom_hi || is_per[idim]) {
+                    fbx.growHi(idim,-1);
                 }
             }
-
-            auto mf_arr = (m_rotate) ? rot_fields[imf]->const_array(mfi) :
-                                           fields[imf]->const_array(mfi);
-
-            if (m_interp) {
-                const auto plo   = geom.ProbLoArray();
-                const auto dxInv = geom.InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
-                    Real interp{0};
-                    trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                       &interp, mf_arr, z_phys_arr, plo, dxInv, 1);
-                    Real val = interp;
-                    Gpu::deviceReduceSum(&plane_avg[imf], val, handler);
-                });
-            } else {
-                auto k_arr  = k_indx->const_array(mfi);
-                auto j_arr  = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr  = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
-                    Real val = mf_arr(mi,mj,mk);
-                    Gpu::deviceReduceSum(&plane_avg[imf], val, handler);
-                });
-            }
         }
-    }
 
-    //
-    //------------------------------------------------------------------------
-    // Averages for virtual potential temperature
-    // (This is cell-centered so we don't need to worry about double-counting)
-    //------------------------------------------------------------------------
-    //
-    if (fields[3]) // We have water vapor
-    {
-        int iavg = 4;
-        denom[iavg]   = 1.0 / (Real)ncell_plane[iavg];
-        val_old[iavg] = plane_average[iavg]*d_fact_old;
-
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*averages[iavg], TileNoZ()); mfi.isValid(); ++mfi)
-        {
-            Box pbx = mfi.tilebox();
-            pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            const Array4<Real const>& T_mf_arr = fields[2]->const_array(mfi);
-            const Array4<Real const>& qv_mf_arr = (fields[3])? fields[3]->const_array(mfi) : Array4<const Real>{};
-            const Array4<Real const>& qr_mf_arr = (fields[4])? fields[4]->const_array(mfi) : Array4<const Real>{};
-
-            if (m_interp) {
-                const auto plo   = m_geom[lev].ProbLoArray();
-                const auto dxInv = m_geom[lev].InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
+        // Index space covering all of the above
+        Box pbx = cbx; pbx.growHi(0,1); pbx.growHi(1,1);
+
+        auto u_mf_arr  = (m_rotate) ? rot_fields[0]->const_array(mfi) :
+                                          fields[0]->const_array(mfi);
+        auto v_mf_arr  = (m_rotate) ? rot_fields[1]->const_array(mfi) :
+                                          fields[1]->const_array(mfi);
+        auto T_mf_arr  = (m_rotate) ? rot_fields[2]->const_array(mfi) :
+                                          fields[2]->const_array(mfi);
+        auto qv_mf_arr = (!fields[3]) ? Array4<const Real>{} :
+                         (m_rotate)   ? rot_fields[3]->const_array(mfi) :
+                                            fields[3]->const_array(mfi);
+        auto qr_mf_arr = (fields[4]) ? fields[4]->const_array(mfi) : Array4<const Real>{};
+
+        // With moisture, Tv is built from the unrotated T and qv; without it Tv is T
+        const bool rotate = m_rotate;
+        auto Tv_T_arr  = fields[2]->const_array(mfi);
+        auto Tv_qv_arr = (fields[3]) ? fields[3]->const_array(mfi) : Array4<const Real>{};
+
+        if (m_interp) {
+            const auto plo   = geom.ProbLoArray();
+            const auto dxInv = geom.InvCellSizeArray();
+            const auto z_phys_arr = z_phys->const_array(mfi);
+            auto x_pos_arr = x_pos->array(mfi);
+            auto y_pos_arr = y_pos->array(mfi);
+            auto z_pos_arr = z_pos->array(mfi);
+            ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
+            AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
+            {
+                const IntVect iv(i,j,k);
+                const Real xp = x_pos_arr(i,j,k);
+                const Real yp = y_pos_arr(i,j,k);
+                const Real zp = z_pos_arr(i,j,k);
+
+                Real val[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                Real u_interp{0};
+                Real v_interp{0};
+                if (ubx.contains(iv) || cbx.contains(iv)) {
+                    trilinear_interp_T(xp, yp, zp, &u_interp, u_mf_arr, z_phys_arr, plo, dxInv, 1);
+                }
+                if (vbx.contains(iv) || cbx.contains(iv)) {
+                    trilinear_interp_T(xp, yp, zp, &v_interp, v_mf_arr, z_phys_arr, plo, dxInv, 1);
+                }
+                if (ubx.contains(iv)) val[0] = u_interp;
+                if (vbx.contains(iv)) val[1] = v_interp;
+                if (cbx.contains(iv)) {
                     Real T_interp{0};
-                    Real qv_interp{0};
-                    trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                       &T_interp, T_mf_arr, z_phys_arr, plo, dxInv, 1);
-                    trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                       &qv_interp, qv_mf_arr, z_phys_arr, plo, dxInv, 1);
-                    Real vfac;
-                    if (qr_mf_arr) {
-                        // We also have liquid water
-                        Real qr_interp{0};
-                        trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                           &qr_interp, qr_mf_arr, z_phys_arr, plo, dxInv, 1);
-                        vfac = 1.0 + 0.61*qv_interp - qr_interp;
-                    } else {
-                        vfac = 1.0 + 0.61*qv_interp;
+                    trilinear_interp_T(xp, yp, zp, &T_interp, T_mf_arr, z_phys_arr, plo, dxInv, 1);
+                    Real Tv_interp = T_interp;
+                    Real vfac = 1.0;
+                    if (qv_mf_arr) {
+                        Real qv_interp{0};
+                        trilinear_interp_T(xp, yp, zp, &qv_interp, qv_mf_arr, z_phys_arr, plo, dxInv, 1);
+                        val[3] = qv_interp;
+                        if (rotate) {
+                            trilinear_interp_T(xp, yp, zp, &Tv_interp, Tv_T_arr , z_phys_arr, plo, dxInv, 1);
+                            trilinear_interp_T(xp, yp, zp, &qv_interp, Tv_qv_arr, z_phys_arr, plo, dxInv, 1);
+                        }
+                        vfac += 0.61*qv_interp;
+                        if (qr_mf_arr) {
+                            // We also have liquid water
+                            Real qr_interp{0};
+                            trilinear_interp_T(xp, yp, zp, &qr_interp, qr_mf_arr, z_phys_arr, plo, dxInv, 1);
+                            vfac -= qr_interp;
+                        }
                     }
-                    const Real val = T_interp * vfac;
-                    Gpu::deviceReduceSum(&plane_avg[iavg], val, handler);
-                });
-            } else {
-                auto k_arr = k_indx->const_array(mfi);
-                auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
-                    Real vfac;
-                    if (qr_mf_arr) {
-                        // We also have liquid water
-                        vfac = 1.0 + 0.61*qv_mf_arr(mi,mj,mk) - qr_mf_arr(mi,mj,mk);
-                    } else {
-                        vfac = 1.0 + 0.61*qv_mf_arr(mi,mj,mk);
+                    val[2] = T_interp;
+                    val[4] = Tv_interp * vfac;
+                    val[5] = std::sqrt(u_interp*u_interp + v_interp*v_interp + Vsg*Vsg);
+                }
+                for (int n(0); n < 6; ++n) {
+                    Gpu::deviceReduceSum(&plane_avg[n], val[n], handler);
+                }
+            });
+        } else {
+            auto k_arr = k_indx->const_array(mfi);
+            auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
+            auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
+            ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
+            AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
+            {
+                const IntVect iv(i,j,k);
+                int mk = k_arr(i,j,k);
+                int mj = j_arr ? j_arr(i,j,k) : j;
+                int mi = i_arr ? i_arr(i,j,k) : i;
+
+                Real val[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                if (ubx.contains(iv)) val[0] = u_mf_arr(mi,mj,mk);
+                if (vbx.contains(iv)) val[1] = v_mf_arr(mi,mj,mk);
+                if (cbx.contains(iv)) {
+                    Real Tv_val = T_mf_arr(mi,mj,mk);
+                    Real vfac = 1.0;
+                    if (qv_mf_arr) {
+                        Tv_val = Tv_T_arr(mi,mj,mk);
+                        vfac += 0.61*Tv_qv_arr(mi,mj,mk);
+                        if (qr_mf_arr) {
+                            // We also have liquid water
+                            vfac -= qr_mf_arr(mi,mj,mk);
+                        }
+                        val[3] = qv_mf_arr(mi,mj,mk);
                     }
-                    const Real val = T_mf_arr(mi,mj,mk) * vfac;
-                    Gpu::deviceReduceSum(&plane_avg[iavg], val, handler);
-                });
-            }
-        }
-    }
-    else // copy temperature
-    {
-        int iavg    = m_navg - 2;
-        denom[iavg] = 1.0 / (Real)ncell_plane[iavg];
-        // plane_avg[iavg] = plane_avg[2]
-        Gpu::copy(Gpu::deviceToDevice, pavg.begin() + 2, pavg.begin() + 3,
-                  pavg.begin() + iavg);
-    }
-
-    //
-    //------------------------------------------------------------------------
-    // Averages for the tangential velocity magnitude
-    // (This is cell-centered so we don't need to worry about double-counting)
-    //------------------------------------------------------------------------
-    //
-    {
-        int imf  = 0;
-        int iavg = m_navg - 1;
-        denom[iavg]   = 1.0 / (Real)ncell_plane[iavg];
-        val_old[iavg] = plane_average[iavg]*d_fact_old;
-
-        const Real Vsg = m_Vsg[lev];
+                    val[2] = T_mf_arr(mi,mj,mk);
+                    val[4] = Tv_val * vfac;
 
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*averages[iavg], TileNoZ()); mfi.isValid(); ++mfi)
-        {
-            Box pbx = mfi.tilebox();
-            pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            // Last element is Umag and always cell centered
-            auto u_mf_arr = (m_rotate) ? rot_fields[imf  ]->const_array(mfi) :
-                                             fields[imf  ]->const_array(mfi);
-            auto v_mf_arr = (m_rotate) ? rot_fields[imf+1]->const_array(mfi) :
-                                             fields[imf+1]->const_array(mfi);
-
-            if (m_interp) {
-                const auto plo   = m_geom[lev].ProbLoArray();
-                const auto dxInv = m_geom[lev].InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
-                    Real u_interp{0};
-                    Real v_interp{0};
-                    trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                            &u_interp, u_mf_arr, z_phys_arr, plo, dxInv, 1);
-                    trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                            &v_interp, v_mf_arr, z_phys_arr, plo, dxInv, 1);
-                    const Real val = std::sqrt(u_interp*u_interp + v_interp*v_interp + Vsg*Vsg);
-                    Gpu::deviceReduceSum(&plane_avg[iavg], val, handler);
-                });
-            } else {
-                auto k_arr = k_indx->const_array(mfi);
-                auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(Gpu::KernelInfo().setReduction(true), pbx, [=]
-                AMREX_GPU_DEVICE(int i, int j, int k, Gpu::Handler const& handler) noexcept
-                {
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
                     const Real u_val = 0.5 * (u_mf_arr(mi,mj,mk) + u_mf_arr(mi+1,mj  ,mk));
                     const Real v_val = 0.5 * (v_mf_arr(mi,mj,mk) + v_mf_arr(mi  ,mj+1,mk));
-                    const Real val = std::sqrt(u_val*u_val + v_val*v_val + Vsg*Vsg);
-                    Gpu::deviceReduceSum(&plane_avg[iavg], val, handler);
-                });
-            }
+                    val[5] = std::sqrt(u_val*u_val + v_val*v_val + Vsg*Vsg);
+                }
+                for (int n(0); n < 6; ++n) {
+                    Gpu::deviceReduceSum(&plane_avg[n], val[n], handler);
+                }
+            });
         }
     }
 
     // Copy to host and sum across procs
-    Gpu::copy(Gpu::deviceToHost, pavg.begin(), pavg.end(), plane_average.begin());
-    ParallelDescriptor::ReduceRealSum(plane_average.data(), plane_average.size());
+    Gpu::copy(Gpu::deviceToHost, m_plane_avg_d[lev].begin(), m_plane_avg_d[lev].end(),
+              m_plane_sum[lev].begin());
+    ParallelDescriptor::ReduceRealSum(m_plane_sum[lev].data(), m_plane_sum[lev].size());
 
     // No spatial variation with plane averages
     for (int iavg(0); iavg < m_navg; ++iavg){
-        plane_average[iavg] *= denom[iavg]*d_fact_new;
-        plane_average[iavg] += val_old[iavg];
+        plane_average[iavg] *= d_fact_old;
+        plane_average[iavg] += m_plane_sum[lev][iavg] * d_fact_new / (Real)ncell_plane[iavg];
         averages[iavg]->setVal(plane_average[iavg]);
     }
 }
@@ -953,6 +887,9 @@ MOSTAverage::compute_plane_averages (int lev)
 /**
  * Function to compute average over local region.
  *
+ * All of the averages (U, V, T, Qv, Tv, Umag) are filled by a single kernel
+ * per tile and their ghost cells are exchanged together.
+ *
  * @param[in] lev Current level
  */
 void
@@ -989,267 +926,187 @@ MOSTAverage::compute_region_averages (int lev)
     // Capture radius for device
     int d_radius = m_radius;
 
-    //
-    //----------------------------------------------------------
-    // Averages for U,V,T,Qv
-    //----------------------------------------------------------
-    //
-    for (int imf(0); imf < 4; ++imf) {
-
-        // Continue if no valid Qv pointer
-        if (!fields[imf]) continue;
+    const Real Vsg = m_Vsg[lev];
 
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*fields[imf], TileNoZ()); mfi.isValid(); ++mfi) {
-            Box pbx = mfi.tilebox(); pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            auto mf_arr = (m_rotate) ? rot_fields[imf]->const_array(mfi) :
-                                           fields[imf]->const_array(mfi);
-            auto ma_arr = averages[imf]->array(mfi);
-
-            if (m_interp) {
-                const auto plo   = geom.ProbLoArray();
-                const auto dx    = geom.CellSizeArray();
-                const auto dxInv = geom.InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    Real met_h_zeta = Compute_h_zeta_AtCellCenter(i,j,k,dxInv,z_phys_arr);
-                    for (int lk(-d_radius); lk <= (d_radius); ++lk) {
-                      for (int lj(-d_radius); lj <= (d_radius); ++lj) {
-                        for (int li(-d_radius); li <= (d_radius); ++li) {
-                            Real interp{0};
-                            Real xp = x_pos_arr(i+li,j+lj,k);
-                            Real yp = y_pos_arr(i+li,j+lj,k);
-                            Real zp = z_pos_arr(i+li,j+lj,k) + met_h_zeta*lk*dx[2];
-                            trilinear_interp_T(xp, yp, zp, &interp, mf_arr, z_phys_arr, plo, dxInv, 1);
-                            Real val = denom * interp * d_fact_new;
-                            ma_arr(i,j,k) += val;
-                        }
-                      }
-                    }
-                });
-            } else {
-                auto k_arr = k_indx->const_array(mfi);
-                auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
-                    for (int lk(mk-d_radius); lk <= (mk+d_radius); ++lk) {
-                      for (int lj(mj-d_radius); lj <= (mj+d_radius); ++lj) {
-                        for (int li(mi-d_radius); li <= (mi+d_radius); ++li) {
-                            Real val = denom * mf_arr(li, lj, lk) * d_fact_new;
-                            ma_arr(i,j,k) += val;
-                        }
-                      }
-                    }
-                });
-            }
-        }
-
-        // Fill interior ghost cells and any ghost cells outside a periodic domain
-        //***********************************************************************************
-        averages[imf]->FillBoundary(geom.periodicity());
-    }
+    // Single MFIter over CC data
+    AMREX_ASSERT(m_navg == 6);
+    int iavg_cc = m_navg - 1;
 
     //
     //----------------------------------------------------------
-    // Averages for virtual potential temperature
+    // Averages for U,V,T,Qv,Tv,Umag
     //----------------------------------------------------------
     //
-    if (fields[3]) // We have water vapor
-    {
-        int iavg = 4;
-
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
-        for (MFIter mfi(*averages[iavg], TileNoZ()); mfi.isValid(); ++mfi) {
-            Box pbx = mfi.tilebox(); pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            const Array4<Real const>& T_mf_arr = fields[2]->const_array(mfi);
-            const Array4<Real const>& qv_mf_arr = (fields[3])? fields[3]->const_array(mfi) : Array4<const Real>{};
-            const Array4<Real const>& qr_mf_arr = (fields[4])? fields[4]->const_array(mfi) : Array4<const Real>{};
-            auto ma_arr   = averages[iavg]->array(mfi);
-
-            if (m_interp) {
-                const auto plo   = geom.ProbLoArray();
-                const auto dx    = geom.CellSizeArray();
-                const auto dxInv = geom.InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    Real met_h_zeta = Compute_h_zeta_AtCellCenter(i,j,k,dxInv,z_phys_arr);
-                    for (int lk(-d_radius); lk <= (d_radius); ++lk) {
-                      for (int lj(-d_radius); lj <= (d_radius); ++lj) {
-                        for (int li(-d_radius); li <= (d_radius); ++li) {
+    for (MFIter mfi(*averages[iavg_cc], TileNoZ()); mfi.isValid(); ++mfi) {
+        // Tiles for the CC and face centered data
+        Box cbx = mfi.tilebox(); cbx.setSmall(2,0); cbx.setBig(2,0);
+        Box ubx = mfi.tilebox(IntVect(1,0,0)); ubx.setSmall(2,0); ubx.setBig(2,0);
+        Box vbx = mfi.tilebox(IntVect(0,1,0)); vbx.setSmall(2,0); vbx.setBig(2,0);
+
+        // Index space covering all of the above
+        Box pbx = cbx; pbx.growHi(0,1); pbx.growHi(1,1);
+
+        auto u_mf_arr  = (m_rotate) ? rot_fields[0]->const_array(mfi) :
+                                          fields[0]->const_array(mfi);
+        auto v_mf_arr  = (m_rotate) ? rot_fields[1]->const_array(mfi) :
+                                          fields[1]->const_array(mfi);
+        auto T_mf_arr  = (m_rotate) ? rot_fields[2]->const_array(mfi) :
+                                          fields[2]->const_array(mfi);
+        auto qv_mf_arr = (!fields[3]) ? Array4<const Real>{} :
+                         (m_rotate)   ? rot_fields[3]->const_array(mfi) :
+                                            fields[3]->const_array(mfi);
+        auto qr_mf_arr = (fields[4]) ? fields[4]->const_array(mfi) : Array4<const Real>{};
+
+        // With moisture, Tv is built from the unrotated T and qv; without it Tv is T
+        const bool rotate = m_rotate;
+        auto Tv_T_arr  = fields[2]->const_array(mfi);
+        auto Tv_qv_arr = (fields[3]) ? fields[3]->const_array(mfi) : Array4<const Real>{};
+
+        auto u_ma_arr  = averages[0]->array(mfi);
+        auto v_ma_arr  = averages[1]->array(mfi);
+        auto T_ma_arr  = averages[2]->array(mfi);
+        auto qv_ma_arr = averages[3]->array(mfi);
+        auto Tv_ma_arr = averages[4]->array(mfi);
+        auto U_ma_arr  = averages[5]->array(mfi);
+
+        // Blend the local sums with the old averages
+        auto update = [=] AMREX_GPU_DEVICE (int i, int j, int k, const IntVect& iv,
+                                            const bool has_qv, const Real* sum) noexcept
+        {
+            const Real fac = denom * d_fact_new;
+            if (ubx.contains(iv)) {
+                u_ma_arr(i,j,k) = u_ma_arr(i,j,k) * d_fact_old + sum[0] * fac;
+            }
+            if (vbx.contains(iv)) {
+                v_ma_arr(i,j,k) = v_ma_arr(i,j,k) * d_fact_old + sum[1] * fac;
+            }
+            if (cbx.contains(iv)) {
+                T_ma_arr(i,j,k)  = T_ma_arr(i,j,k)  * d_fact_old + sum[2] * fac;
+                Tv_ma_arr(i,j,k) = Tv_ma_arr(i,j,k) * d_fact_old + sum[4] * fac;
+                U_ma_arr(i,j,k)  = U_ma_arr(i,j,k)  * d_fact_old + sum[5] * fac;
+                if (has_qv) {
+                    qv_ma_arr(i,j,k) = qv_ma_arr(i,j,k) * d_fact_old + sum[3] * fac;
+                }
+            }
+        };
+
+        if (m_interp) {
+            const auto plo   = geom.ProbLoArray();
+            const auto dx    = geom.CellSizeArray();
+            const auto dxInv = geom.InvCellSizeArray();
+            const auto z_phys_arr = z_phys->const_array(mfi);
+            auto x_pos_arr = x_pos->array(mfi);
+            auto y_pos_arr = y_pos->array(mfi);
+            auto z_pos_arr = z_pos->array(mfi);
+            ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            {
+                const IntVect iv(i,j,k);
+                const bool in_u = ubx.contains(iv) || cbx.contains(iv);
+                const bool in_v = vbx.contains(iv) || cbx.contains(iv);
+                const bool in_c = cbx.contains(iv);
+
+                Real sum[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                Real met_h_zeta = Compute_h_zeta_AtCellCenter(i,j,k,dxInv,z_phys_arr);
+                for (int lk(-d_radius); lk <= (d_radius); ++lk) {
+                  for (int lj(-d_radius); lj <= (d_radius); ++lj) {
+                    for (int li(-d_radius); li <= (d_radius); ++li) {
+                        Real xp = x_pos_arr(i+li,j+lj,k);
+                        Real yp = y_pos_arr(i+li,j+lj,k);
+                        Real zp = z_pos_arr(i+li,j+lj,k) + met_h_zeta*lk*dx[2];
+                        Real u_interp{0};
+                        Real v_interp{0};
+                        if (in_u) trilinear_interp_T(xp, yp, zp, &u_interp, u_mf_arr, z_phys_arr, plo, dxInv, 1);
+                        if (in_v) trilinear_interp_T(xp, yp, zp, &v_interp, v_mf_arr, z_phys_arr, plo, dxInv, 1);
+                        sum[0] += u_interp;
+                        sum[1] += v_interp;
+                        if (in_c) {
                             Real T_interp{0};
-                            Real qv_interp{0};
-                            Real xp = x_pos_arr(i+li,j+lj,k);
-                            Real yp = y_pos_arr(i+li,j+lj,k);
-                            Real zp = z_pos_arr(i+li,j+lj,k) + met_h_zeta*lk*dx[2];
-                            trilinear_interp_T(xp, yp, zp, &T_interp,  T_mf_arr,  z_phys_arr, plo, dxInv, 1);
-                            trilinear_interp_T(xp, yp, zp, &qv_interp, qv_mf_arr, z_phys_arr, plo, dxInv, 1);
-                            Real vfac;
-                            if (qr_mf_arr) {
-                                // We also have liquid water
-                                Real qr_interp{0};
-                                trilinear_interp_T(x_pos_arr(i,j,k), y_pos_arr(i,j,k), z_pos_arr(i,j,k),
-                                                   &qr_interp, qr_mf_arr, z_phys_arr, plo, dxInv, 1);
-                                vfac = 1.0 + 0.61*qv_interp - qr_interp;
-                            } else {
-                                vfac = 1.0 + 0.61*qv_interp;
+                            trilinear_interp_T(xp, yp, zp, &T_interp, T_mf_arr, z_phys_arr, plo, dxInv, 1);
+                            Real Tv_interp = T_interp;
+                            Real vfac = 1.0;
+                            if (qv_mf_arr) {
+                                Real qv_interp{0};
+                                trilinear_interp_T(xp, yp, zp, &qv_interp, qv_mf_arr, z_phys_arr, plo, dxInv, 1);
+                                sum[3] += qv_interp;
+                                if (rotate) {
+                                    trilinear_interp_T(xp, yp, zp, &Tv_interp, Tv_T_arr , z_phys_arr, plo, dxInv, 1);
+                                    trilinear_interp_T(xp, yp, zp, &qv_interp, Tv_qv_arr, z_phys_arr, plo, dxInv, 1);
+                                }
+                                vfac += 0.61*qv_interp;
+                                if (qr_mf_arr) {
+                                    // We also have liquid water
+                                    Real qr_interp{0};
+                                    trilinear_interp_T(xp, yp, zp, &qr_interp, qr_mf_arr, z_phys_arr, plo, dxInv, 1);
+                                    vfac -= qr_interp;
+                                }
                             }
-                            const Real mag = T_interp * vfac;
-                            const Real val = denom * mag * d_fact_new;
-                            ma_arr(i,j,k) += val;
+                            sum[2] += T_interp;
+                            sum[4] += Tv_interp * vfac;
+                            sum[5] += std::sqrt(u_interp*u_interp + v_interp*v_interp + Vsg*Vsg);
                         }
-                      }
                     }
-                });
-            } else {
-                auto k_arr = k_indx->const_array(mfi);
-                auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
-                    for (int lk(mk-d_radius); lk <= (mk+d_radius); ++lk) {
-                      for (int lj(mj-d_radius); lj <= (mj+d_radius); ++lj) {
-                        for (int li(mi-d_radius); li <= (mi+d_radius); ++li) {
-                            Real vfac;
-                            if (qr_mf_arr) {
-                                // We also have liquid water
-                                vfac = 1.0 + 0.61*qv_mf_arr(li,lj,lk) - qr_mf_arr(li,lj,lk);
-                            } else {
-                                vfac = 1.0 + 0.61*qv_mf_arr(li,lj,lk);
+                  }
+                }
+                update(i, j, k, iv, bool(qv_mf_arr), sum);
+            });
+        } else {
+            auto k_arr = k_indx->const_array(mfi);
+            auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
+            auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
+            ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            {
+                const IntVect iv(i,j,k);
+                const bool in_u = ubx.contains(iv);
+                const bool in_v = vbx.contains(iv);
+                const bool in_c = cbx.contains(iv);
+
+                Real sum[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                int mk = k_arr(i,j,k);
+                int mj = j_arr ? j_arr(i,j,k) : j;
+                int mi = i_arr ? i_arr(i,j,k) : i;
+                for (int lk(mk-d_radius); lk <= (mk+d_radius); ++lk) {
+                  for (int lj(mj-d_radius); lj <= (mj+d_radius); ++lj) {
+                    for (int li(mi-d_radius); li <= (mi+d_radius); ++li) {
+                        if (in_u) sum[0] += u_mf_arr(li,lj,lk);
+                        if (in_v) sum[1] += v_mf_arr(li,lj,lk);
+                        if (in_c) {
+                            Real Tv_val = T_mf_arr(li,lj,lk);
+                            Real vfac = 1.0;
+                            if (qv_mf_arr) {
+                                Tv_val = Tv_T_arr(li,lj,lk);
+                                vfac += 0.61*Tv_qv_arr(li,lj,lk);
+                                if (qr_mf_arr) {
+                                    // We also have liquid water
+                                    vfac -= qr_mf_arr(li,lj,lk);
+                                }
+                                sum[3] += qv_mf_arr(li,lj,lk);
                             }
-                            const Real mag = T_mf_arr(li,lj,lk) * vfac;
-                            const Real val = denom * mag * d_fact_new;
-                            ma_arr(i,j,k) += val;
-                        }
-                      }
-                    }
-                });
-            }
-
-            // Fill interior ghost cells and any ghost cells outside a periodic domain
-            //***********************************************************************************
-            averages[iavg]->FillBoundary(geom.periodicity());
-        }
-    }
-    else // copy temperature
-    {
-        int iavg   = m_navg - 2;
-        IntVect ng = averages[iavg]->nGrowVect();
-        MultiFab::Copy(*(averages[iavg]),*(averages[2]),0,0,1,ng);
-    }
-
-    //
-    //----------------------------------------------------------
-    // Averages for the tangential velocity magnitude
-    //----------------------------------------------------------
-    //
-    {
-        int imf  = 0;
-        int iavg = m_navg - 1;
-
-        const Real Vsg = m_Vsg[lev];
+                            sum[2] += T_mf_arr(li,lj,lk);
+                            sum[4] += Tv_val * vfac;
 
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*averages[iavg], TileNoZ()); mfi.isValid(); ++mfi) {
-            Box pbx = mfi.tilebox(); pbx.setSmall(2,0); pbx.setBig(2,0);
-
-            auto u_mf_arr = (m_rotate) ? rot_fields[imf  ]->const_array(mfi) :
-                                             fields[imf  ]->const_array(mfi);
-            auto v_mf_arr = (m_rotate) ? rot_fields[imf+1]->const_array(mfi) :
-                                             fields[imf+1]->const_array(mfi);
-            auto ma_arr   = averages[iavg]->array(mfi);
-
-            if (m_interp) {
-                const auto plo   = geom.ProbLoArray();
-                const auto dx    = geom.CellSizeArray();
-                const auto dxInv = geom.InvCellSizeArray();
-                const auto z_phys_arr = z_phys->const_array(mfi);
-                auto x_pos_arr = x_pos->array(mfi);
-                auto y_pos_arr = y_pos->array(mfi);
-                auto z_pos_arr = z_pos->array(mfi);
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    Real met_h_zeta = Compute_h_zeta_AtCellCenter(i,j,k,dxInv,z_phys_arr);
-                    for (int lk(-d_radius); lk <= (d_radius); ++lk) {
-                      for (int lj(-d_radius); lj <= (d_radius); ++lj) {
-                        for (int li(-d_radius); li <= (d_radius); ++li) {
-                            Real u_interp{0};
-                            Real v_interp{0};
-                            Real xp = x_pos_arr(i+li,j+lj,k);
-                            Real yp = y_pos_arr(i+li,j+lj,k);
-                            Real zp = z_pos_arr(i+li,j+lj,k) + met_h_zeta*lk*dx[2];
-                            trilinear_interp_T(xp, yp, zp, &u_interp, u_mf_arr, z_phys_arr, plo, dxInv, 1);
-                            trilinear_interp_T(xp, yp, zp, &v_interp, v_mf_arr, z_phys_arr, plo, dxInv, 1);
-                            const Real mag = std::sqrt(u_interp*u_interp + v_interp*v_interp + Vsg*Vsg);
-                            Real val = denom * mag * d_fact_new;
-                            ma_arr(i,j,k) += val;
-                        }
-                      }
-                    }
-                });
-            } else {
-                auto k_arr = k_indx->const_array(mfi);
-                auto j_arr = j_indx ? j_indx->const_array(mfi) : Array4<const int> {};
-                auto i_arr = i_indx ? i_indx->const_array(mfi) : Array4<const int> {};
-                ParallelFor(pbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-                {
-                    ma_arr(i,j,k) *= d_fact_old;
-
-                    int mk = k_arr(i,j,k);
-                    int mj = j_arr ? j_arr(i,j,k) : j;
-                    int mi = i_arr ? i_arr(i,j,k) : i;
-                    for (int lk(mk-d_radius); lk <= (mk+d_radius); ++lk) {
-                      for (int lj(mj-d_radius); lj <= (mj+d_radius); ++lj) {
-                        for (int li(mi-d_radius); li <= (mi+d_radius); ++li) {
                             const Real u_val = 0.5 * (u_mf_arr(li,lj,lk) + u_mf_arr(li+1,lj  ,lk));
                             const Real v_val = 0.5 * (v_mf_arr(li,lj,lk) + v_mf_arr(li  ,lj+1,lk));
-                            const Real mag   = std::sqrt(u_val*u_val + v_val*v_val + Vsg*Vsg);
-                            Real val = denom * mag * d_fact_new;
-                            ma_arr(i,j,k) += val;
+                            sum[5] += std::sqrt(u_val*u_val + v_val*v_val + Vsg*Vsg);
                         }
-                      }
                     }
-                });
-            }
-
-            // Fill interior ghost cells and any ghost cells outside a periodic domain
-            //***********************************************************************************
-            averages[iavg]->FillBoundary(geom.periodicity());
+                  }
+                }
+                update(i, j, k, iv, bool(qv_mf_arr), sum);
+            });
         }
     }
 
+    // Fill interior ghost cells and any ghost cells outside a periodic domain
+    //***********************************************************************************
+    {
+        Vector<MultiFab*> avg_ptrs(m_navg);
+        for (int iavg(0); iavg < m_navg; ++iavg) avg_ptrs[iavg] = averages[iavg].get();
+        amrex::FillBoundary(avg_ptrs, geom.periodicity());
+    }
+
 
     // Need to fill ghost cells outside the domain if not periodic
     bool not_per_x = !(geom.periodicity().isPeriodic(0));
@@ -230,7 +230,7 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
     // Extrapolate Kturb in x/y, fill remaining elements (relevant to lev==0)
     //***********************************************************************************
     int ngc(1);
-    // EddyDiff mapping :   Theta_h     KE_h         QKE_h      Scalar_h    Q_h
+    // EddyDiff mapping :   Theta       KE           QKE        Scalar      Q
     Vector<Real> Factors = {inv_Pr_t, inv_sigma_k, inv_sigma_k, inv_Sc_t, inv_Sc_t}; // alpha = mu/Pr
     Gpu::AsyncVector<Real> d_Factors; d_Factors.resize(Factors.size());
     Gpu::copy(Gpu::hostToDevice, Factors.begin(), Factors.end(), d_Factors.begin());
@@ -239,6 +239,10 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
     bool use_KE  = (turbChoice.les_type == LESType::Deardorff);
     bool use_QKE = turbChoice.use_QKE;
 
+    // With compact storage only the momentum pair exists; the scalar diffusivities
+    // are formed from it where they are used
+    const int npairs = eddyViscosity.nComp() / 2;
+
 #ifdef _OPENMP
 #pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
@@ -320,18 +324,17 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
             }
         }
 
-        for (auto n = 1; n < (EddyDiff::NumDiffs-1)/2; ++n) {
-            int offset = (EddyDiff::NumDiffs-1)/2;
-            switch (n)
+        for (auto n = 1; n < npairs; ++n) {
+            switch (2*n)
             {
               case EddyDiff::QKE_h:
                  // Populate element other than mom_h/v on the whole grid
                  if(use_QKE) {
                    ParallelFor(bxcc, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                    {
-                       int indx   = n;
-                       int indx_v = indx + offset;
-                       mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[indx-1];
+                       int indx   = 2*n;
+                       int indx_v = indx + 1;
+                       mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[n-1];
                        mu_turb(i,j,k,indx_v) = mu_turb(i,j,k,indx);
                   });
                  }
@@ -340,9 +343,9 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
                 if (use_KE) {
                    ParallelFor(bxcc, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                    {
-                       int indx   = n;
-                       int indx_v = indx + offset;
-                       mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[indx-1];
+                       int indx   = 2*n;
+                       int indx_v = indx + 1;
+                       mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[n-1];
                        mu_turb(i,j,k,indx_v) = mu_turb(i,j,k,indx);
                    });
                 }
@@ -350,10 +353,10 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
             default:
                 ParallelFor(bxcc, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                 {
-                    int indx   = n;
-                    int indx_v = indx + offset;
+                    int indx   = 2*n;
+                    int indx_v = indx + 1;
 
-                    mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[indx-1];
+                    mu_turb(i,j,k,indx)   = mu_turb(i,j,k,EddyDiff::Mom_h) * fac_ptr[n-1];
 
                     // NOTE: Theta_v has already been set for Deardorff
                     if (!(indx_v == EddyDiff::Theta_v && use_KE)) {
@@ -385,17 +388,16 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
 
         const Array4<Real>& mu_turb = eddyViscosity.array(mfi);
 
-        for (auto n = 0; n < (EddyDiff::NumDiffs-1)/2; ++n) {
-            int offset = (EddyDiff::NumDiffs-1)/2;
-            switch (n)
+        for (auto n = 0; n < npairs; ++n) {
+            switch (2*n)
             {
               case EddyDiff::QKE_h:
                  // Extrap all components at top & bottom
                  if(use_QKE) {
                     ParallelFor(planez, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        int indx = n;
-                        int indx_v = indx + offset;
+                        int indx   = 2*n;
+                        int indx_v = indx + 1;
                         mu_turb(i, j, k_lo-k, indx  ) = mu_turb(i, j, k_lo, indx  );
                         mu_turb(i, j, k_hi+k, indx  ) = mu_turb(i, j, k_hi, indx  );
                         mu_turb(i, j, k_lo-k, indx_v) = mu_turb(i, j, k_lo, indx_v);
@@ -407,8 +409,8 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
                  if (use_KE) {
                     ParallelFor(planez, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        int indx   = n;
-                        int indx_v = indx + offset;
+                        int indx   = 2*n;
+                        int indx_v = indx + 1;
                         mu_turb(i, j, k_lo-k, indx  ) = mu_turb(i, j, k_lo, indx  );
                         mu_turb(i, j, k_hi+k, indx  ) = mu_turb(i, j, k_hi, indx  );
                         mu_turb(i, j, k_lo-k, indx_v) = mu_turb(i, j, k_lo, indx_v);
@@ -419,8 +421,8 @@ void ComputeTurbulentViscosityLES (const MultiFab& Tau11, const MultiFab& Tau22,
               default:
                  ParallelFor(planez, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                  {
-                     int indx   = n;
-                     int indx_v = indx + offset;
+                     int indx   = 2*n;
+                     int indx_v = indx + 1;
                      mu_turb(i, j, k_lo-k, indx  ) = mu_turb(i, j, k_lo, indx  );
                      mu_turb(i, j, k_hi+k, indx  ) = mu_turb(i, j, k_hi, indx  );
                      mu_turb(i, j, k_lo-k, indx_v) = mu_turb(i, j, k_lo, indx_v);
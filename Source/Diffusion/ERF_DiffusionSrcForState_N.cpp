@@ -173,11 +173,27 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
     Vector<int> eddy_diff_idz{EddyDiff::Theta_v, EddyDiff::KE_v, EddyDiff::QKE_v, EddyDiff::Scalar_v,
                               EddyDiff::Q_v    , EddyDiff::Q_v, EddyDiff::Q_v ,
                               EddyDiff::Q_v    , EddyDiff::Q_v, EddyDiff::Q_v };
+    Vector<Real> eddy_diff_fac(eddy_diff_idx.size(), 1.0);
+
+    // Compact storage only holds the momentum diffusivities, so scale them here
+    if (turbChoice.compact_eddy_diffs) {
+        for (int n = 0; n < int(eddy_diff_idx.size()); ++n) {
+            eddy_diff_idx[n] = EddyDiff::Mom_h;
+            eddy_diff_idy[n] = EddyDiff::Mom_h;
+            eddy_diff_idz[n] = EddyDiff::Mom_v;
+            if (n == PrimTheta_comp) {
+                eddy_diff_fac[n] = turbChoice.Pr_t_inv;
+            } else if (n >= PrimScalar_comp) {
+                eddy_diff_fac[n] = turbChoice.Sc_t_inv;
+            }
+        }
+    }
 
     // Device vectors
-    Gpu::AsyncVector<Real> alpha_eff_d;
+    Gpu::AsyncVector<Real> alpha_eff_d, eddy_diff_fac_d;
     Gpu::AsyncVector<int>  eddy_diff_idx_d,eddy_diff_idy_d,eddy_diff_idz_d;
     alpha_eff_d.resize(alpha_eff.size());
+    eddy_diff_fac_d.resize(eddy_diff_fac.size());
     eddy_diff_idx_d.resize(eddy_diff_idx.size());
     eddy_diff_idy_d.resize(eddy_diff_idy.size());
     eddy_diff_idz_d.resize(eddy_diff_idz.size());
@@ -186,12 +202,14 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idx.begin(), eddy_diff_idx.end(), eddy_diff_idx_d.begin());
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idy.begin(), eddy_diff_idy.end(), eddy_diff_idy_d.begin());
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idz.begin(), eddy_diff_idz.end(), eddy_diff_idz_d.begin());
+    Gpu::copy(Gpu::hostToDevice, eddy_diff_fac.begin(), eddy_diff_fac.end(), eddy_diff_fac_d.begin());
 
     // Capture pointers for device code
     Real* d_alpha_eff     = alpha_eff_d.data();
     int*  d_eddy_diff_idx = eddy_diff_idx_d.data();
     int*  d_eddy_diff_idy = eddy_diff_idy_d.data();
     int*  d_eddy_diff_idz = eddy_diff_idz_d.data();
+    Real* d_eddy_diff_fac = eddy_diff_fac_d.data();
 
     // Compute fluxes at each face
     if (l_consA && l_turb) {
@@ -214,8 +232,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i-1, j, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_scal_index])
-                              + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_scal_index])
+                                                                 + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_scal_index]) );
 
             if (ext_dir_on_xlo) {
                 xflux(i,j,k,qty_index) = -rhoAlpha * ( -(8./3.) * cell_prim(i-1, j, k, prim_index)
@@ -249,8 +267,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i, j-1, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_scal_index])
-                              + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_scal_index])
+                                                                 + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_scal_index]) );
 
             if (ext_dir_on_ylo) {
                 yflux(i,j,k,qty_index) = -rhoAlpha * ( -(8./3.) * cell_prim(i, j-1, k, prim_index)
@@ -273,8 +291,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i, j, k-1, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_scal_index])
-                              + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_scal_index])
+                                                                 + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_scal_index]) );
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
                            BCVars::RhoScalar_bc_comp : qty_index;
@@ -335,8 +353,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
                                     && i == dom_hi.x+1);
 
             Real rhoAlpha = d_alpha_eff[prim_index];
-            rhoAlpha += 0.5 * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_index])
-                              + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_index])
+                                                            + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_index]) );
 
             if (ext_dir_on_xlo) {
                 xflux(i,j,k,qty_index) = -rhoAlpha * ( -(8./3.) * cell_prim(i-1, j, k, prim_index)
@@ -366,8 +384,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
                                     && j == dom_hi.y+1);
 
             Real rhoAlpha = d_alpha_eff[prim_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_index])
-                              + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_index])
+                                                            + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_index]) );
 
             if (ext_dir_on_ylo) {
                 yflux(i,j,k,qty_index) = -rhoAlpha * ( -(8./3.) * cell_prim(i, j-1, k, prim_index)
@@ -387,8 +405,8 @@ DiffusionSrcForState_N (const Box& bx, const Box& domain,
             const int prim_index = qty_index - 1;
 
             Real rhoAlpha = d_alpha_eff[prim_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_index])
-                              + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_index])
+                                                            + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_index]) );
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
                            BCVars::RhoScalar_bc_comp : qty_index;
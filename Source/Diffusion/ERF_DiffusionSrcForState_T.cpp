@@ -21,6 +21,7 @@ using namespace amrex;
  * @param[in]  yflux flux in y-dir
  * @param[in]  zflux flux in z-dir
  * @param[in]  z_nd physical z height
+ * @param[in]  face_met precomputed face metric terms (empty if the metrics are computed from z_nd)
  * @param[in]  detJ Jacobian determinant
  * @param[in]  cellSizeInv inverse cell size array
  * @param[in]  SmnSmn_a strain rate magnitude
@@ -53,6 +54,7 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
                         const Array4<Real>& yflux,
                         const Array4<Real>& zflux,
                         const Array4<const Real>& z_nd,
+                        const Array4<const Real>& face_met,
                         const Array4<const Real>& ax,
                         const Array4<const Real>& ay,
                         const Array4<const Real>& az,
@@ -89,6 +91,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
     const Real dy_inv = cellSizeInv[1];
     const Real dz_inv = cellSizeInv[2];
 
+    const TerrainFaceMetrics met(z_nd, face_met, cellSizeInv);
+
     const auto& dom_hi = ubound(domain);
 
     bool l_use_QKE       = turbChoice.use_QKE;
@@ -186,11 +190,27 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
     Vector<int> eddy_diff_idz{EddyDiff::Theta_v, EddyDiff::KE_v, EddyDiff::QKE_v, EddyDiff::Scalar_v,
                               EddyDiff::Q_v    , EddyDiff::Q_v, EddyDiff::Q_v ,
                               EddyDiff::Q_v    , EddyDiff::Q_v, EddyDiff::Q_v };
+    Vector<Real> eddy_diff_fac(eddy_diff_idx.size(), 1.0);
+
+    // Compact storage only holds the momentum diffusivities, so scale them here
+    if (turbChoice.compact_eddy_diffs) {
+        for (int n = 0; n < int(eddy_diff_idx.size()); ++n) {
+            eddy_diff_idx[n] = EddyDiff::Mom_h;
+            eddy_diff_idy[n] = EddyDiff::Mom_h;
+            eddy_diff_idz[n] = EddyDiff::Mom_v;
+            if (n == PrimTheta_comp) {
+                eddy_diff_fac[n] = turbChoice.Pr_t_inv;
+            } else if (n >= PrimScalar_comp) {
+                eddy_diff_fac[n] = turbChoice.Sc_t_inv;
+            }
+        }
+    }
 
     // Device vectors
-    Gpu::AsyncVector<Real> alpha_eff_d;
+    Gpu::AsyncVector<Real> alpha_eff_d, eddy_diff_fac_d;
     Gpu::AsyncVector<int>  eddy_diff_idx_d,eddy_diff_idy_d,eddy_diff_idz_d;
     alpha_eff_d.resize(alpha_eff.size());
+    eddy_diff_fac_d.resize(eddy_diff_fac.size());
     eddy_diff_idx_d.resize(eddy_diff_idx.size());
     eddy_diff_idy_d.resize(eddy_diff_idy.size());
     eddy_diff_idz_d.resize(eddy_diff_idz.size());
@@ -199,12 +219,14 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idx.begin(), eddy_diff_idx.end(), eddy_diff_idx_d.begin());
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idy.begin(), eddy_diff_idy.end(), eddy_diff_idy_d.begin());
     Gpu::copy(Gpu::hostToDevice, eddy_diff_idz.begin(), eddy_diff_idz.end(), eddy_diff_idz_d.begin());
+    Gpu::copy(Gpu::hostToDevice, eddy_diff_fac.begin(), eddy_diff_fac.end(), eddy_diff_fac_d.begin());
 
     // Capture pointers for device code
     Real* d_alpha_eff     = alpha_eff_d.data();
     int*  d_eddy_diff_idx = eddy_diff_idx_d.data();
     int*  d_eddy_diff_idy = eddy_diff_idy_d.data();
     int*  d_eddy_diff_idz = eddy_diff_idz_d.data();
+    Real* d_eddy_diff_fac = eddy_diff_fac_d.data();
 
     // Constant alpha & Turb model
     if (l_consA && l_turb) {
@@ -216,10 +238,10 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i-1, j, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_scal_index])
-                              + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_scal_index])
+                                                                 + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_scal_index]) );
 
-            Real met_h_xi   = Compute_h_xi_AtIface  (i,j,k,cellSizeInv,z_nd);
+            Real met_h_xi   = met.h_xi_AtIface  (i,j,k);
             Real met_h_zeta = ax(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -249,10 +271,10 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i, j-1, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_scal_index])
-                              + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_scal_index])
+                                                                 + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_scal_index]) );
 
-            Real met_h_eta  = Compute_h_eta_AtJface (i,j,k,cellSizeInv,z_nd);
+            Real met_h_eta  = met.h_eta_AtJface (i,j,k);
             Real met_h_zeta = ay(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -281,8 +303,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
 
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i, j, k-1, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_scal_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_scal_index])
-                              + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_scal_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_scal_index] * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_scal_index])
+                                                                 + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_scal_index]) );
 
             Real met_h_zeta = az(i,j,k);
 
@@ -340,10 +362,10 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             const int prim_index = qty_index - 1;
 
             Real rhoAlpha = d_alpha_eff[prim_index];
-            rhoAlpha += 0.5 * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_index])
-                              + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i  , j, k, d_eddy_diff_idx[prim_index])
+                                                            + mu_turb(i-1, j, k, d_eddy_diff_idx[prim_index]) );
 
-            Real met_h_xi   = Compute_h_xi_AtIface  (i,j,k,cellSizeInv,z_nd);
+            Real met_h_xi   = met.h_xi_AtIface  (i,j,k);
             Real met_h_zeta = ax(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -370,10 +392,10 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             const int prim_index = qty_index - 1;
 
             Real rhoAlpha = d_alpha_eff[prim_index];
-            rhoAlpha += 0.5 * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_index])
-                              + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i, j  , k, d_eddy_diff_idy[prim_index])
+                                                            + mu_turb(i, j-1, k, d_eddy_diff_idy[prim_index]) );
 
-            Real met_h_eta  = Compute_h_eta_AtJface (i,j,k,cellSizeInv,z_nd);
+            Real met_h_eta  = met.h_eta_AtJface (i,j,k);
             Real met_h_zeta = ay(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -401,8 +423,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
 
             Real rhoAlpha = d_alpha_eff[prim_index];
 
-            rhoAlpha += 0.5 * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_index])
-                              + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_index]) );
+            rhoAlpha += 0.5 * d_eddy_diff_fac[prim_index] * ( mu_turb(i, j, k  , d_eddy_diff_idz[prim_index])
+                                                            + mu_turb(i, j, k-1, d_eddy_diff_idz[prim_index]) );
 
             Real met_h_zeta = az(i,j,k);
 
@@ -462,7 +484,7 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i-1, j, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_index];
 
-            Real met_h_xi   = Compute_h_xi_AtIface  (i,j,k,cellSizeInv,z_nd);
+            Real met_h_xi   = met.h_xi_AtIface  (i,j,k);
             Real met_h_zeta = ax(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -491,7 +513,7 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             Real rhoFace  = 0.5 * ( cell_data(i, j, k, Rho_comp) + cell_data(i, j-1, k, Rho_comp) );
             Real rhoAlpha = rhoFace * d_alpha_eff[prim_index];
 
-            Real met_h_eta  = Compute_h_eta_AtJface (i,j,k,cellSizeInv,z_nd);
+            Real met_h_eta  = met.h_eta_AtJface (i,j,k);
             Real met_h_zeta = ay(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -578,8 +600,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             Real rhoAlpha = d_alpha_eff[prim_index];
 
             Real met_h_xi,met_h_zeta;
-            met_h_xi   = Compute_h_xi_AtIface  (i,j,k,cellSizeInv,z_nd);
-            met_h_zeta = Compute_h_zeta_AtIface(i,j,k,cellSizeInv,z_nd);
+            met_h_xi   = met.h_xi_AtIface  (i,j,k);
+            met_h_zeta = met.h_zeta_AtIface(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
                            BCVars::RhoScalar_bc_comp : qty_index;
@@ -607,8 +629,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             Real rhoAlpha = d_alpha_eff[prim_index];
 
             Real met_h_eta,met_h_zeta;
-            met_h_eta  = Compute_h_eta_AtJface (i,j,k,cellSizeInv,z_nd);
-            met_h_zeta = Compute_h_zeta_AtJface(i,j,k,cellSizeInv,z_nd);
+            met_h_eta  = met.h_eta_AtJface (i,j,k);
+            met_h_zeta = met.h_zeta_AtJface(i,j,k);
 
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
                            BCVars::RhoScalar_bc_comp : qty_index;
@@ -636,7 +658,7 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
             Real rhoAlpha = d_alpha_eff[prim_index];
 
             Real met_h_zeta;
-            met_h_zeta = Compute_h_zeta_AtKface(i,j,k,cellSizeInv,z_nd);
+            met_h_zeta = met.h_zeta_AtKface(i,j,k);
 
             Real GradCz;
             int bc_comp = (qty_index >= RhoScalar_comp && qty_index < RhoScalar_comp+NSCALARS) ?
@@ -699,8 +721,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
           Real met_h_xi,met_h_eta;
 
           { // Bottom face
-            met_h_xi  = Compute_h_xi_AtKface (i,j,k_lo,cellSizeInv,z_nd);
-            met_h_eta = Compute_h_eta_AtKface(i,j,k_lo,cellSizeInv,z_nd);
+            met_h_xi  = met.h_xi_AtKface (i,j,k_lo);
+            met_h_eta = met.h_eta_AtKface(i,j,k_lo);
 
             Real xfluxlo  = 0.5 * ( xflux(i  , j  , k_lo  , qty_index) + xflux(i+1, j  , k_lo  , qty_index) );
             Real xfluxhi  = 0.5 * ( xflux(i  , j  , k_lo+1, qty_index) + xflux(i+1, j  , k_lo+1, qty_index) );
@@ -714,8 +736,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
           }
 
           { // Top face
-            met_h_xi  = Compute_h_xi_AtKface (i,j,k_hi,cellSizeInv,z_nd);
-            met_h_eta = Compute_h_eta_AtKface(i,j,k_hi,cellSizeInv,z_nd);
+            met_h_xi  = met.h_xi_AtKface (i,j,k_hi);
+            met_h_eta = met.h_eta_AtKface(i,j,k_hi);
 
             Real xfluxlo  = 0.5 * ( xflux(i  , j  , k_hi-2, qty_index) + xflux(i+1, j  , k_hi-2, qty_index) );
             Real xfluxhi  = 0.5 * ( xflux(i  , j  , k_hi-1, qty_index) + xflux(i+1, j  , k_hi-1, qty_index) );
@@ -735,8 +757,8 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
       const int  qty_index = start_comp + n;
 
       Real met_h_xi,met_h_eta;
-      met_h_xi  = Compute_h_xi_AtKface (i,j,k,cellSizeInv,z_nd);
-      met_h_eta = Compute_h_eta_AtKface(i,j,k,cellSizeInv,z_nd);
+      met_h_xi  = met.h_xi_AtKface (i,j,k);
+      met_h_eta = met.h_eta_AtKface(i,j,k);
 
       Real xfluxbar = 0.25 * ( xflux(i  , j  , k  , qty_index) + xflux(i+1, j  , k  , qty_index)
                              + xflux(i  , j  , k-1, qty_index) + xflux(i+1, j  , k-1, qty_index) );
@@ -749,13 +771,13 @@ DiffusionSrcForState_T (const Box& bx, const Box& domain,
     ParallelFor(xbx, num_comp, [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
     {
       const int  qty_index = start_comp + n;
-      Real met_h_zeta      = Compute_h_zeta_AtIface(i,j,k,cellSizeInv,z_nd);
+      Real met_h_zeta      = met.h_zeta_AtIface(i,j,k);
       xflux(i,j,k,qty_index) *= met_h_zeta;
     });
     ParallelFor(ybx, num_comp, [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
     {
       const int  qty_index = start_comp + n;
-      Real met_h_zeta      = Compute_h_zeta_AtJface(i,j,k,cellSizeInv,z_nd);
+      Real met_h_zeta      = met.h_zeta_AtJface(i,j,k);
       yflux(i,j,k,qty_index) *= met_h_zeta;
     });
 
@@ -12,6 +12,7 @@
 #include <AMReX_buildInfo.H>
 #include <ERF_Utils.H>
 #include <ERF_TerrainMetrics.H>
+#include <ERF_PlaneAverage.H>
 #include <memory>
 
 using namespace amrex;
@@ -20,6 +21,7 @@ Real ERF::startCPUTime        = 0.0;
 Real ERF::previousCPUTimeUsed = 0.0;
 
 Vector<AMRErrorTag> ERF::ref_tags;
+Vector<ERF::RefTagCriterion> ERF::ref_tag_criteria;
 
 SolverChoice ERF::solverChoice;
 
@@ -117,7 +119,14 @@ ERF::ERF_shared ()
 #endif
 
 #if defined(ERF_USE_RRTMGP)
+    rad.resize(nlevs_max);
+    rad_full.resize(nlevs_max);
     qheating_rates.resize(nlevs_max);
+    qheating_rates_last.resize(nlevs_max);
+    qheating_rates_prev.resize(nlevs_max);
+    rad_ncalls.resize(nlevs_max, 0);
+    rad_time_last.resize(nlevs_max, 0.0);
+    rad_time_prev.resize(nlevs_max, 0.0);
     sw_lw_fluxes.resize(nlevs_max);
     solar_zenith.resize(nlevs_max);
 #endif
@@ -227,6 +236,7 @@ ERF::ERF_shared ()
     SFS_q1fx1_lev.resize(nlevs_max); SFS_q1fx2_lev.resize(nlevs_max); SFS_q1fx3_lev.resize(nlevs_max);
     SFS_q2fx3_lev.resize(nlevs_max);
     eddyDiffs_lev.resize(nlevs_max);
+    box_costs.resize(nlevs_max);
     SmnSmn_lev.resize(nlevs_max);
 
     // Sea surface temps
@@ -240,6 +250,7 @@ ERF::ERF_shared ()
     ax.resize(nlevs_max);
     ay.resize(nlevs_max);
     az.resize(nlevs_max);
+    face_metrics.resize(nlevs_max);
 
     z_phys_nd_new.resize(nlevs_max);
     detJ_cc_new.resize(nlevs_max);
@@ -253,6 +264,14 @@ ERF::ERF_shared ()
     ay_src.resize(nlevs_max);
     az_src.resize(nlevs_max);
 
+    z_phys_nd_stash.resize(nlevs_max);
+    detJ_cc_stash.resize(nlevs_max);
+    metric_time_z.resize(nlevs_max);
+    metric_time_areas.resize(nlevs_max);
+    metric_step_time.resize(nlevs_max);
+    num_metric_rebuilds.resize(nlevs_max,0);
+    num_metric_reuses.resize(nlevs_max,0);
+
     z_t_rk.resize(nlevs_max);
 
     // Mapfactors
@@ -378,6 +397,8 @@ ERF::Evolve ()
 
         if (writeNow(cur_time, dt[0], step+1, m_check_int, m_check_per)) {
             last_check_file_step = step+1;
+            // Samples up to the checkpoint must be on disk before a restart from it
+            if (ts_sampler) { ts_sampler->flush(); }
 #ifdef ERF_USE_NETCDF
             if (check_type == "netcdf") {
                WriteNCCheckpointFile();
@@ -418,6 +439,12 @@ ERF::Evolve ()
         }
     }
 
+    // Write the samples still held in memory
+    if (ts_sampler) { ts_sampler->flush(); }
+
+    // Make sure the last checkpoint is on disk before we return
+    WaitForCheckpoint();
+
     BL_PROFILE_VAR_STOP(evolve);
 }
 
@@ -544,6 +571,11 @@ ERF::post_timestep (int nstep, Real time, Real dt_lev0)
         data_sampler->write_sample_data(t_new, istep, ref_ratio, geom);
     }
 
+    // Record probe time series; these are buffered and written in batches
+    if (ts_sampler) {
+        ts_sampler->sample(istep[0], time, dt_lev0, finest_level, geom, vars_new);
+    }
+
     // Moving terrain
     if ( solverChoice.use_terrain &&  (solverChoice.terrain_type == TerrainType::Moving) )
     {
@@ -552,6 +584,7 @@ ERF::post_timestep (int nstep, Real time, Real dt_lev0)
         // Copy z_phs_nd and detJ_cc at end of timestep
         MultiFab::Copy(*z_phys_nd[lev], *z_phys_nd_new[lev], 0, 0, 1, z_phys_nd[lev]->nGrowVect());
         MultiFab::Copy(  *detJ_cc[lev],   *detJ_cc_new[lev], 0, 0, 1,   detJ_cc[lev]->nGrowVect());
+        metric_time_z[lev][MetricSet::Old] = metric_time_z[lev][MetricSet::New];
         MultiFab::Copy(base_state[lev],base_state_new[lev],0,0,3,1);
 
         make_zcc(geom[lev],*z_phys_nd[lev],*z_phys_cc[lev]);
@@ -1001,6 +1034,11 @@ ERF::InitData_post ()
 #endif
                                            );
 
+        for (int lev = 0; lev <= max_level; ++lev) {
+            m_most->set_eddy_diff_factors(lev, solverChoice.turbChoice[lev].Pr_t_inv,
+                                               solverChoice.turbChoice[lev].Sc_t_inv);
+        }
+
 
         if (restart_chkfile != "") {
             // Update surface fields if needed
@@ -1178,6 +1216,11 @@ ERF::InitData_post ()
     pp.query("do_line_sampling",do_line); pp.query("do_plane_sampling",do_plane);
     if (do_line || do_plane) { data_sampler = std::make_unique<SampleData>(do_line, do_plane); }
 
+    // Create object to record time series at probes if needed
+    if (pp.contains("ts.samplers")) {
+        ts_sampler = std::make_unique<TimeSeriesSampler>((restart_chkfile.empty()) ? -1 : istep[0]);
+    }
+
 #ifdef ERF_USE_EB
     bool write_eb_surface = false;
     pp.query("write_eb_surface", write_eb_surface);
@@ -1384,6 +1427,14 @@ ERF::ReadParameters ()
         pp.query("restart_type", restart_type);
 
         pp.query("regrid_int", regrid_int);
+
+        // Load balancing with measured costs
+        pp.query("load_balance_int", load_balance_int);
+        pp.query("load_balance_method", load_balance_method);
+        pp.query("load_balance_threshold", load_balance_threshold);
+        if (load_balance_method != "knapsack" && load_balance_method != "sfc") {
+            Abort("erf.load_balance_method must be knapsack or sfc");
+        }
         pp.query("check_file", check_file);
         pp.query("check_type", check_type);
 
@@ -1470,6 +1521,14 @@ ERF::ReadParameters ()
 
         // NetCDF wrfbdy lateral boundary file
         pp.query("nc_bdy_file", nc_bdy_file);
+
+        // Read the 3D wrfinput fields in parallel rather than on the I/O rank
+        pp.query("nc_distributed_read", nc_distributed_read);
+
+        // Only keep the wrfbdy snapshots we need in memory
+        pp.query("nc_bdy_lazy", nc_bdy_lazy);
+        pp.query("nc_bdy_lookahead", nc_bdy_lookahead);
+        AMREX_ALWAYS_ASSERT(nc_bdy_lookahead >= 0);
 #endif
 
         // Flag to trigger initialization from input_sounding like WRF's ideal.exe
@@ -1497,6 +1556,11 @@ ERF::ReadParameters ()
         pp.query("plot_lsm", plot_lsm);
 #ifdef ERF_USE_RRTMGP
         pp.query("plot_rad", plot_rad);
+        pp.query("rad_interval", rad_interval);
+        pp.query("rad_extrapolate", rad_extrapolate);
+        pp.query("rad_coarsen", rad_coarsen);
+        pp.query("rad_coarsen_check", rad_coarsen_check);
+        AMREX_ALWAYS_ASSERT_WITH_MESSAGE(rad_coarsen >= 1, "erf.rad_coarsen must be >= 1");
 #endif
 
         pp.query("output_1d_column", output_1d_column);
@@ -1760,47 +1824,25 @@ ERF::MakeHorizontalAverages ()
 void // NOLINTNEXTLINE
 ERF::MakeDiagnosticAverage (Vector<Real>& h_havg, MultiFab& S, int n)
 {
-    // Get the number of cells in z at level 0
-    int dir_z = AMREX_SPACEDIM-1;
-    auto domain = geom[0].Domain();
-    int size_z = domain.length(dir_z);
-    int start_z = domain.smallEnd()[dir_z];
-    Real area_z = static_cast<Real>(domain.length(0)*domain.length(1));
-
-    // resize the level 0 horizontal average vectors
-    h_havg.resize(size_z, 0.0_rt);
-
-    // Get the cell centered data and construct sums
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-    for (MFIter mfi(S); mfi.isValid(); ++mfi) {
-        const Box& box = mfi.validbox();
-        const IntVect& se = box.smallEnd();
-        const IntVect& be = box.bigEnd();
+    // Accumulate the plane sums of component n at level 0 in one pass
+    HorizontalAverages<1> havg(geom[0].Domain());
 
-        auto      fab_arr = S[mfi].array();
-
-        FArrayBox fab_reduce(box, 1, The_Async_Arena());
-        auto arr_reduce   = fab_reduce.array();
+    for (MFIter mfi(S,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Box& bx = mfi.tilebox();
+        const Array4<const Real>& fab_arr = S.const_array(mfi);
 
-        ParallelFor(box, [=] AMREX_GPU_DEVICE (int i, int j, int k) {
-            arr_reduce(i, j, k, 0) = fab_arr(i,j,k,n);
+        havg.add(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,1>& f) noexcept
+        {
+            f[0] = fab_arr(i,j,k,n);
         });
-
-        for (int k=se[dir_z]; k <= be[dir_z]; ++k) {
-            Box kbox(box); kbox.setSmall(dir_z,k); kbox.setBig(dir_z,k);
-            h_havg[k-start_z] += fab_reduce.sum<RunOn::Device>(kbox,0);
-        }
     }
 
-    // combine sums from different MPI ranks
-    ParallelDescriptor::ReduceRealSum(h_havg.dataPtr(), h_havg.size());
+    // Combine sums from different MPI ranks and divide by the number of cells in the plane
+    havg.reduce();
 
-    // divide by the total number of cells we are averaging over
-    for (int k = 0; k < size_z; ++k) {
-        h_havg[k]     /= area_z;
-    }
+    Gpu::HostVector<Real> line;
+    havg.line(0, line);
+    h_havg.assign(line.begin(), line.end());
 }
 
 // Set covered coarse cells to be the average of overlying fine cells for all levels
@@ -1,11 +1,113 @@
 #include <ERF.H>
-#include <ERF_Derive.H>
+#include <ERF_EOS.H>
 
 using namespace amrex;
 
+namespace {
+
+// Fields that the fused tagging kernel can evaluate directly from the state
+namespace TagField {
+    enum {
+        Other = 0, // evaluated through AMRErrorTag (e.g. particle counts)
+        None,      // box-only criterion
+        Density,
+        Qv,
+        Qc,
+        Theta,
+        Scalar,
+        Pressure,
+        Vorticity
+    };
+}
+
+int
+tag_field_from_name (const std::string& name)
+{
+    if (name.empty())         { return TagField::None;      }
+    if (name == "density")    { return TagField::Density;   }
+    if (name == "qv")         { return TagField::Qv;        }
+    if (name == "qc")         { return TagField::Qc;        }
+    if (name == "theta")      { return TagField::Theta;     }
+    if (name == "scalar")     { return TagField::Scalar;    }
+    if (name == "pressure")   { return TagField::Pressure;  }
+    if (name == "vorticity")  { return TagField::Vorticity; }
+    return TagField::Other;
+}
+
+// Per-criterion data captured by the tagging kernel
+struct TagParams {
+    int  field;
+    int  test;
+    Real threshold;
+    int  use_box;
+    Real box_lo[AMREX_SPACEDIM];
+    Real box_hi[AMREX_SPACEDIM];
+};
+
+/**
+ * Value of a tagging field at cell (i,j,k); neighbor indices are clamped to the domain.
+ * The vorticity magnitude uses the undeformed grid spacing and ignores map factors.
+ */
+AMREX_GPU_DEVICE
+AMREX_FORCE_INLINE
+Real
+tag_field_value (int field, int i, int j, int k,
+                 const Array4<const Real>& cons,
+                 const Array4<const Real>& u,
+                 const Array4<const Real>& v,
+                 const Array4<const Real>& w,
+                 const GpuArray<Real,AMREX_SPACEDIM>& dxInv,
+                 const Dim3& dlo, const Dim3& dhi,
+                 bool has_moist)
+{
+    const Real rho = cons(i,j,k,Rho_comp);
+    switch (field)
+    {
+      case TagField::Density:
+        return rho;
+      case TagField::Qv:
+        return (has_moist) ? cons(i,j,k,RhoQ1_comp) / rho : 0.0;
+      case TagField::Qc:
+        return (has_moist) ? cons(i,j,k,RhoQ2_comp) / rho : 0.0;
+      case TagField::Theta:
+        return cons(i,j,k,RhoTheta_comp) / rho;
+      case TagField::Scalar:
+        return cons(i,j,k,RhoScalar_comp) / rho;
+      case TagField::Pressure:
+      {
+        Real qv = (has_moist) ? cons(i,j,k,RhoQ1_comp) / rho : 0.0;
+        return getPgivenRTh(cons(i,j,k,RhoTheta_comp), qv);
+      }
+      case TagField::Vorticity:
+      {
+        int im = amrex::max(i-1,dlo.x); int ip = amrex::min(i+1,dhi.x);
+        int jm = amrex::max(j-1,dlo.y); int jp = amrex::min(j+1,dhi.y);
+        int km = amrex::max(k-1,dlo.z); int kp = amrex::min(k+1,dhi.z);
+        auto uc = [&] (int ii, int jj, int kk) { return 0.5*(u(ii,jj,kk) + u(ii+1,jj  ,kk  )); };
+        auto vc = [&] (int ii, int jj, int kk) { return 0.5*(v(ii,jj,kk) + v(ii  ,jj+1,kk  )); };
+        auto wc = [&] (int ii, int jj, int kk) { return 0.5*(w(ii,jj,kk) + w(ii  ,jj  ,kk+1)); };
+        Real fx = dxInv[0] / amrex::max(ip-im,1);
+        Real fy = dxInv[1] / amrex::max(jp-jm,1);
+        Real fz = dxInv[2] / amrex::max(kp-km,1);
+        Real om_x = (wc(i,jp,k) - wc(i,jm,k)) * fy - (vc(i,j,kp) - vc(i,j,km)) * fz;
+        Real om_y = (uc(i,j,kp) - uc(i,j,km)) * fz - (wc(ip,j,k) - wc(im,j,k)) * fx;
+        Real om_z = (vc(ip,j,k) - vc(im,j,k)) * fx - (uc(i,jp,k) - uc(i,jm,k)) * fy;
+        return std::sqrt(om_x*om_x + om_y*om_y + om_z*om_z);
+      }
+      default:
+        return 0.0;
+    }
+}
+
+} // namespace
+
 /**
  * Function to tag cells for refinement -- this overrides the pure virtual function in AmrCore
  *
+ * All criteria on density, qv, qc, theta, scalar, pressure and vorticity magnitude are
+ * evaluated directly from vars_new in one kernel per tile that writes into the tags.
+ * Any other criterion (e.g. particle counts) still goes through its AMRErrorTag.
+ *
  * @param[in] levc level of refinement at which we tag cells (0 is coarsest level)
  * @param[out] tags array of tagged cells
  * @param[in] time current time
@@ -14,85 +116,170 @@ using namespace amrex;
 void
 ERF::ErrorEst (int levc, TagBoxArray& tags, Real time, int /*ngrow*/)
 {
+    BL_PROFILE("ERF::ErrorEst()");
+
     const int clearval = TagBox::CLEAR;
     const int   tagval = TagBox::SET;
 
-    for (int j=0; j < ref_tags.size(); ++j)
+    // Collect the criteria that are active at this level and time
+    //***********************************************************************************
+    Vector<TagParams> params;
+    bool need_nbrs = false;
+    bool need_vel  = false;
+    for (int j=0; j < ref_tag_criteria.size(); ++j)
     {
-        std::unique_ptr<MultiFab> mf = std::make_unique<MultiFab>(grids[levc], dmap[levc], 1, 0);
-
-        // This allows dynamic refinement based on the value of the density
-        if (ref_tags[j].Field() == "density")
-        {
-            MultiFab::Copy(*mf,vars_new[levc][Vars::cons],Rho_comp,0,1,0);
-
-        // This allows dynamic refinement based on the value of qv
-        } else if ( ref_tags[j].Field() == "qv" ) {
-            MultiFab::Copy(  *mf, vars_new[levc][Vars::cons], RhoQ1_comp, 0, 1, 0);
-            MultiFab::Divide(*mf, vars_new[levc][Vars::cons],   Rho_comp, 0, 1, 0);
-
+        const auto& crit = ref_tag_criteria[j];
+        if (crit.field == TagField::Other) continue;
+        if (time < crit.info.m_min_time || time > crit.info.m_max_time ||
+            levc >= crit.info.m_max_level) continue;
+
+        TagParams tp;
+        tp.field     = crit.field;
+        tp.test      = static_cast<int>(crit.test);
+        tp.threshold = (crit.value.empty()) ? 0.0 :
+                       crit.value[amrex::min(levc, static_cast<int>(crit.value.size())-1)];
+        tp.use_box   = crit.info.m_realbox.ok();
+        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+            tp.box_lo[d] = crit.info.m_realbox.lo(d);
+            tp.box_hi[d] = crit.info.m_realbox.hi(d);
+        }
+        params.push_back(tp);
 
-        // This allows dynamic refinement based on the value of qc
-        } else if (ref_tags[j].Field() == "qc" ) {
-            MultiFab::Copy(  *mf, vars_new[levc][Vars::cons], RhoQ2_comp, 0, 1, 0);
-            MultiFab::Divide(*mf, vars_new[levc][Vars::cons],   Rho_comp, 0, 1, 0);
+        need_nbrs |= (crit.test == AMRErrorTag::GRAD || crit.field == TagField::Vorticity);
+        need_vel  |= (crit.field == TagField::Vorticity);
+    }
 
+    if (!params.empty())
+    {
+        MultiFab& cons = vars_new[levc][Vars::cons];
+        if (need_nbrs) {
+            cons.FillBoundary(geom[levc].periodicity());
+            if (need_vel) {
+                vars_new[levc][Vars::xvel].FillBoundary(geom[levc].periodicity());
+                vars_new[levc][Vars::yvel].FillBoundary(geom[levc].periodicity());
+                vars_new[levc][Vars::zvel].FillBoundary(geom[levc].periodicity());
+            }
+        }
 
-        // This allows dynamic refinement based on the value of the scalar/pressure/theta
-        } else if ( (ref_tags[j].Field() == "scalar"  ) ||
-                    (ref_tags[j].Field() == "pressure") ||
-                    (ref_tags[j].Field() == "theta"   ) )
+        Gpu::AsyncVector<TagParams> params_d(params.size());
+        Gpu::copy(Gpu::hostToDevice, params.begin(), params.end(), params_d.begin());
+        const TagParams* d_params = params_d.data();
+        const int nparams = params.size();
+
+        const bool has_moist = (cons.nComp() > RhoQ2_comp);
+        const auto dxInv     = geom[levc].InvCellSizeArray();
+        const auto dx        = geom[levc].CellSizeArray();
+        const auto prob_lo   = geom[levc].ProbLoArray();
+        const Box& domain    = geom[levc].Domain();
+        const auto dlo       = lbound(domain);
+        const auto dhi       = ubound(domain);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(tags, TilingIfNotGPU()); mfi.isValid(); ++mfi)
         {
-            for (MFIter mfi(*mf, TilingIfNotGPU()); mfi.isValid(); ++mfi)
+            const Box& bx = mfi.tilebox();
+            const auto& tag_arr = tags.array(mfi);
+            const Array4<const Real>& cons_arr = cons.const_array(mfi);
+            const Array4<const Real>& u_arr = (need_vel) ? vars_new[levc][Vars::xvel].const_array(mfi) : Array4<const Real>{};
+            const Array4<const Real>& v_arr = (need_vel) ? vars_new[levc][Vars::yvel].const_array(mfi) : Array4<const Real>{};
+            const Array4<const Real>& w_arr = (need_vel) ? vars_new[levc][Vars::zvel].const_array(mfi) : Array4<const Real>{};
+
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
-                const Box& bx = mfi.tilebox();
-                auto& dfab = (*mf)[mfi];
-                auto& sfab = vars_new[levc][Vars::cons][mfi];
-                if (ref_tags[j].Field() == "scalar") {
-                    derived::erf_derscalar(bx, dfab, 0, 1, sfab, Geom(levc), time, nullptr, levc);
-                } else if (ref_tags[j].Field() == "theta") {
-                    derived::erf_dertheta(bx, dfab, 0, 1, sfab, Geom(levc), time, nullptr, levc);
+                const Real xc[AMREX_SPACEDIM] = {AMREX_D_DECL(prob_lo[0] + (i+0.5)*dx[0],
+                                                              prob_lo[1] + (j+0.5)*dx[1],
+                                                              prob_lo[2] + (k+0.5)*dx[2])};
+                for (int n = 0; n < nparams; ++n)
+                {
+                    const TagParams& tp = d_params[n];
+                    if (tp.use_box) {
+                        bool inside = true;
+                        for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                            inside = inside && (xc[d] >= tp.box_lo[d]) && (xc[d] <= tp.box_hi[d]);
+                        }
+                        if (!inside) continue;
+                    }
+
+                    bool tag_it = false;
+                    if (tp.test == AMRErrorTag::BOX) {
+                        tag_it = true;
+                    } else {
+                        Real val = tag_field_value(tp.field, i, j, k, cons_arr, u_arr, v_arr, w_arr,
+                                                   dxInv, dlo, dhi, has_moist);
+                        if (tp.test == AMRErrorTag::GREATER) {
+                            tag_it = (val > tp.threshold);
+                        } else if (tp.test == AMRErrorTag::LESS) {
+                            tag_it = (val < tp.threshold);
+                        } else if (tp.test == AMRErrorTag::GRAD) {
+                            Real grad = 0.0;
+                            const int ii[2] = {amrex::max(i-1,dlo.x), amrex::min(i+1,dhi.x)};
+                            const int jj[2] = {amrex::max(j-1,dlo.y), amrex::min(j+1,dhi.y)};
+                            const int kk[2] = {amrex::max(k-1,dlo.z), amrex::min(k+1,dhi.z)};
+                            for (int s = 0; s < 2; ++s) {
+                                grad = amrex::max(grad, std::abs(val - tag_field_value(tp.field, ii[s], j, k,
+                                       cons_arr, u_arr, v_arr, w_arr, dxInv, dlo, dhi, has_moist)));
+                                grad = amrex::max(grad, std::abs(val - tag_field_value(tp.field, i, jj[s], k,
+                                       cons_arr, u_arr, v_arr, w_arr, dxInv, dlo, dhi, has_moist)));
+                                grad = amrex::max(grad, std::abs(val - tag_field_value(tp.field, i, j, kk[s],
+                                       cons_arr, u_arr, v_arr, w_arr, dxInv, dlo, dhi, has_moist)));
+                            }
+                            tag_it = (grad >= tp.threshold);
+                        }
+                    }
+                    if (tag_it) {
+                        tag_arr(i,j,k) = tagval;
+                        break;
+                    }
                 }
-            } // mfi
+            });
+        } // mfi
+    }
+
+    // Remaining criteria go through AMRErrorTag
+    //***********************************************************************************
+    for (int j=0; j < ref_tags.size(); ++j)
+    {
+        if (ref_tag_criteria[j].field != TagField::Other) continue;
+
+        std::unique_ptr<MultiFab> mf = std::make_unique<MultiFab>(grids[levc], dmap[levc], 1, 0);
+        mf->setVal(0.0);
 #ifdef ERF_USE_PARTICLES
-        } else {
-            //
-            // This allows dynamic refinement based on the number of particles per cell
-            //
-            // Note that we must count all the particles in levels both at and above the current,
-            //      since otherwise, e.g., if the particles are all at level 1, counting particles at
-            //      level 0 will not trigger refinement when regridding so level 1 will disappear,
-            //      then come back at the next regridding
-            //
-            const auto& particles_namelist( particleData.getNames() );
-            mf->setVal(0.0);
-            for (ParticlesNamesVector::size_type i = 0; i < particles_namelist.size(); i++)
-            {
-                std::string tmp_string(particles_namelist[i]+"_count");
-                IntVect rr = IntVect::TheUnitVector();
-                if (ref_tags[j].Field() == tmp_string) {
-                    for (int lev = levc; lev <= finest_level; lev++)
-                    {
-                        MultiFab temp_dat(grids[lev], dmap[lev], 1, 0); temp_dat.setVal(0);
-                        particleData[particles_namelist[i]]->IncrementWithTotal(temp_dat, lev);
+        //
+        // This allows dynamic refinement based on the number of particles per cell
+        //
+        // Note that we must count all the particles in levels both at and above the current,
+        //      since otherwise, e.g., if the particles are all at level 1, counting particles at
+        //      level 0 will not trigger refinement when regridding so level 1 will disappear,
+        //      then come back at the next regridding
+        //
+        const auto& particles_namelist( particleData.getNames() );
+        for (ParticlesNamesVector::size_type i = 0; i < particles_namelist.size(); i++)
+        {
+            std::string tmp_string(particles_namelist[i]+"_count");
+            IntVect rr = IntVect::TheUnitVector();
+            if (ref_tags[j].Field() == tmp_string) {
+                for (int lev = levc; lev <= finest_level; lev++)
+                {
+                    MultiFab temp_dat(grids[lev], dmap[lev], 1, 0); temp_dat.setVal(0);
+                    particleData[particles_namelist[i]]->IncrementWithTotal(temp_dat, lev);
 
-                        MultiFab temp_dat_crse(grids[levc], dmap[levc], 1, 0); temp_dat_crse.setVal(0);
+                    MultiFab temp_dat_crse(grids[levc], dmap[levc], 1, 0); temp_dat_crse.setVal(0);
 
-                        if (lev == levc) {
-                            MultiFab::Copy(*mf, temp_dat, 0, 0, 1, 0);
-                        } else {
-                            for (int d = 0; d < AMREX_SPACEDIM; d++) {
-                                rr[d] *= ref_ratio[levc][d];
-                            }
-                            average_down(temp_dat, temp_dat_crse, 0, 1, rr);
-                            MultiFab::Add(*mf, temp_dat_crse, 0, 0, 1, 0);
+                    if (lev == levc) {
+                        MultiFab::Copy(*mf, temp_dat, 0, 0, 1, 0);
+                    } else {
+                        for (int d = 0; d < AMREX_SPACEDIM; d++) {
+                            rr[d] *= ref_ratio[levc][d];
                         }
+                        average_down(temp_dat, temp_dat_crse, 0, 1, rr);
+                        MultiFab::Add(*mf, temp_dat_crse, 0, 0, 1, 0);
                     }
                 }
             }
-#endif
         }
-
+#endif
         ref_tags[j](tags,mf.get(),clearval,tagval,time,levc,geom[levc]);
     } // loop over j
 }
@@ -293,6 +480,7 @@ ERF::refinement_criteria_setup ()
                 ppr.getarr("value_greater",value,0,num_val);
                 std::string field; ppr.get("field_name",field);
                 ref_tags.push_back(AMRErrorTag(value,AMRErrorTag::GREATER,field,info));
+                ref_tag_criteria.push_back({tag_field_from_name(field), AMRErrorTag::GREATER, value, info});
             }
             else if (ppr.countval("value_less")) {
                 int num_val = ppr.countval("value_less");
@@ -300,6 +488,7 @@ ERF::refinement_criteria_setup ()
                 ppr.getarr("value_less",value,0,num_val);
                 std::string field; ppr.get("field_name",field);
                 ref_tags.push_back(AMRErrorTag(value,AMRErrorTag::LESS,field,info));
+                ref_tag_criteria.push_back({tag_field_from_name(field), AMRErrorTag::LESS, value, info});
             }
             else if (ppr.countval("adjacent_difference_greater")) {
                 int num_val = ppr.countval("adjacent_difference_greater");
@@ -307,10 +496,12 @@ ERF::refinement_criteria_setup ()
                 ppr.getarr("adjacent_difference_greater",value,0,num_val);
                 std::string field; ppr.get("field_name",field);
                 ref_tags.push_back(AMRErrorTag(value,AMRErrorTag::GRAD,field,info));
+                ref_tag_criteria.push_back({tag_field_from_name(field), AMRErrorTag::GRAD, value, info});
             }
             else if (realbox.ok())
             {
                 ref_tags.push_back(AMRErrorTag(info));
+                ref_tag_criteria.push_back({TagField::None, AMRErrorTag::BOX, {}, info});
             } else {
                 Abort(std::string("Unrecognized refinement indicator for " + refinement_indicators[i]).c_str());
             }
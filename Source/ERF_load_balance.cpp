@@ -0,0 +1,139 @@
+#include <ERF.H>
+
+using namespace amrex;
+
+/**
+ * Return the per-box cost accumulator of a level, (re)allocated and zeroed if the
+ * grids or the distribution mapping changed, or nullptr when load balancing is off.
+ * The dycore kernels add the wall time of their work on each box to it (see
+ * box_cost_start / box_cost_stop), so communication is not charged to the boxes.
+ *
+ * @param[in] lev level of refinement
+ */
+LayoutData<Real>*
+ERF::get_box_costs (int lev)
+{
+    if (load_balance_int <= 0) return nullptr;
+
+    const BoxArray&            ba = grids[lev];
+    const DistributionMapping& dm = dmap[lev];
+
+    if (!box_costs[lev] ||
+        box_costs[lev]->boxArray() != ba ||
+        box_costs[lev]->DistributionMap() != dm)
+    {
+        box_costs[lev] = std::make_unique<LayoutData<Real>>(ba, dm);
+        for (MFIter mfi(*box_costs[lev]); mfi.isValid(); ++mfi) {
+            (*box_costs[lev])[mfi] = 0.0;
+        }
+    }
+    return box_costs[lev].get();
+}
+
+/**
+ * Charge the kernel wall time spent by this rank in a physics package whose box
+ * loops are not timed individually (microphysics, radiation) to the boxes
+ * it owns at that level. The time is split over the local boxes in proportion to
+ * their number of cells, or to per-box weights when the work is not uniform over the
+ * cells (e.g. shortwave radiation, which only runs on daylit columns). The time must
+ * not include communication.
+ *
+ * @param[in] lev     level of refinement
+ * @param[in] wtime   kernel wall time on this rank
+ * @param[in] weights optional work estimate of each local box, indexed by LocalIndex
+ */
+void
+ERF::add_box_costs (int lev, Real wtime, const Vector<Real>& weights)
+{
+    LayoutData<Real>* cost = get_box_costs(lev);
+    if (cost == nullptr) return;
+
+    const bool use_weights = !weights.empty();
+    AMREX_ASSERT(!use_weights || weights.size() == static_cast<std::size_t>(cost->local_size()));
+
+    auto box_weight = [&] (const MFIter& mfi) -> Real
+    {
+        return (use_weights) ? weights[mfi.LocalIndex()]
+                             : static_cast<Real>(mfi.validbox().numPts());
+    };
+
+    Real weight_local = 0.0;
+    for (MFIter mfi(*cost); mfi.isValid(); ++mfi) {
+        weight_local += box_weight(mfi);
+    }
+    if (weight_local <= 0.0) return;
+
+    for (MFIter mfi(*cost); mfi.isValid(); ++mfi) {
+        (*cost)[mfi] += wtime * box_weight(mfi) / weight_local;
+    }
+}
+
+/**
+ * Build a distribution mapping for a level from the measured box costs and, if it
+ * improves the parallel efficiency (average over maximum rank cost) by more than
+ * load_balance_threshold, move the level onto it. Level 0, and any level when the
+ * terrain is moving, is only reported since RemakeLevel does not support it.
+ *
+ * @param[in] lev level of refinement
+ */
+void
+ERF::load_balance (int lev)
+{
+    BL_PROFILE("ERF::load_balance()");
+
+    if (!box_costs[lev] ||
+        box_costs[lev]->boxArray() != grids[lev] ||
+        box_costs[lev]->DistributionMap() != dmap[lev]) {
+        return;
+    }
+
+    Real current_eff  = 0.0;
+    Real proposed_eff = 0.0;
+    DistributionMapping new_dm;
+    if (load_balance_method == "sfc") {
+        new_dm = DistributionMapping::makeSFC(*box_costs[lev], current_eff, proposed_eff);
+    } else {
+        new_dm = DistributionMapping::makeKnapSack(*box_costs[lev], current_eff, proposed_eff);
+    }
+
+    // RemakeLevel cannot rebuild level 0 or the metrics of moving terrain
+    const bool moving_terrain = (solverChoice.terrain_type == TerrainType::Moving);
+    const bool redistribute = ( lev > 0 && !moving_terrain &&
+                                proposed_eff > (1.0 + load_balance_threshold) * current_eff );
+
+    Print() << "Load balance at level " << lev
+            << ": efficiency " << current_eff
+            << ", with " << load_balance_method << " " << proposed_eff;
+    if (redistribute) {
+        Print() << " -- redistributing" << std::endl;
+    } else if (lev == 0) {
+        Print() << " -- level 0 is not redistributed" << std::endl;
+    } else if (moving_terrain) {
+        Print() << " -- levels with moving terrain are not redistributed" << std::endl;
+    } else {
+        Print() << " -- keeping the current mapping" << std::endl;
+    }
+
+    if (redistribute) {
+        RemakeLevel(lev, t_new[lev], grids[lev], new_dm);
+        SetDistributionMap(lev, new_dm);
+
+        // The fine level's FillPatcher and flux register hold this level's mapping
+        if (lev < finest_level) {
+            if (cf_width >= 0) {
+                Define_ERFFillPatchers(lev+1);
+            }
+            if (solverChoice.coupling_type == CouplingType::TwoWay) {
+                delete advflux_reg[lev+1];
+                advflux_reg[lev+1] = new YAFluxRegister(grids[lev+1], grids[lev],
+                                                        dmap[lev+1] , dmap[lev],
+                                                        geom[lev+1] , geom[lev],
+                                                        ref_ratio[lev], lev+1,
+                                                        vars_new[0][Vars::cons].nComp());
+            }
+        }
+    }
+
+    // Start measuring again
+    box_costs[lev].reset();
+}
@@ -15,6 +15,7 @@
 #include <ERF_Utils.H>
 #include <ERF_TerrainMetrics.H>
 #include <ERF_ParFunctions.H>
+#include <limits>
 #include <memory>
 
 using namespace amrex;
@@ -58,6 +59,13 @@ ERF::init_stuff (int lev, const BoxArray& ba, const DistributionMapping& dm,
             z_t_rk[lev] = std::make_unique<MultiFab>( convert(ba, IntVect(0,0,1)), dm, 1, 1 );
         }
 
+        if (solverChoice.cache_terrain_metrics) {
+            face_metrics[lev] = std::make_unique<MultiFab>(ba,dm,FaceMetric::NumComps,1);
+            face_metrics[lev]->setVal(0.0);
+        } else {
+            face_metrics[lev] = nullptr;
+        }
+
         BoxArray ba_nd(ba);
         ba_nd.surroundingNodes();
 
@@ -68,11 +76,16 @@ ERF::init_stuff (int lev, const BoxArray& ba, const DistributionMapping& dm,
         if (solverChoice.terrain_type != TerrainType::Static) {
             z_phys_nd_new[lev] = std::make_unique<MultiFab>(ba_nd,dm,1,IntVect(ngrow,ngrow,ngrow));
             z_phys_nd_src[lev] = std::make_unique<MultiFab>(ba_nd,dm,1,IntVect(ngrow,ngrow,ngrow));
+
+            z_phys_nd_stash[lev] = std::make_unique<MultiFab>(ba_nd,dm,1,IntVect(ngrow,ngrow,ngrow));
+              detJ_cc_stash[lev] = std::make_unique<MultiFab>(ba,dm,1,1);
+            invalidate_moving_terrain_metrics(lev);
         }
 
     } else {
             z_phys_nd[lev] = nullptr;
             z_phys_cc[lev] = nullptr;
+         face_metrics[lev] = nullptr;
 
         z_phys_nd_new[lev] = nullptr;
           detJ_cc_new[lev] = nullptr;
@@ -80,6 +93,9 @@ ERF::init_stuff (int lev, const BoxArray& ba, const DistributionMapping& dm,
         z_phys_nd_src[lev] = nullptr;
           detJ_cc_src[lev] = nullptr;
 
+        z_phys_nd_stash[lev] = nullptr;
+          detJ_cc_stash[lev] = nullptr;
+
                z_t_rk[lev] = nullptr;
     }
 
@@ -286,6 +302,21 @@ ERF::init_stuff (int lev, const BoxArray& ba, const DistributionMapping& dm,
     qheating_rates[lev] = std::make_unique<MultiFab>(ba, dm, 2, ngrow_state);
     qheating_rates[lev]->setVal(0.);
 
+    if (rad_extrapolate) {
+        qheating_rates_last[lev] = std::make_unique<MultiFab>(ba, dm, 2, 0);
+        qheating_rates_prev[lev] = std::make_unique<MultiFab>(ba, dm, 2, 0);
+    }
+
+    // The workspace is kept across regrids and resized by Radiation if needed,
+    // but the heating rates above are new so the next step must call radiation
+    if (!rad[lev]) {
+        rad[lev] = std::make_unique<Radiation>(rad_coarsen);
+    }
+    if (rad_coarsen > 1 && rad_coarsen_check && !rad_full[lev]) {
+        rad_full[lev] = std::make_unique<Radiation>(1);
+    }
+    rad_ncalls[lev] = 0;
+
     //*********************************************************
     // Radiation fluxes for coupling to LSM
     //*********************************************************
@@ -427,8 +458,20 @@ ERF::update_diffusive_arrays (int lev, const BoxArray& ba, const DistributionMap
     }
 
     if (l_use_kturb) {
-        eddyDiffs_lev[lev] = std::make_unique<MultiFab>(ba, dm, EddyDiff::NumDiffs, 2);
+        bool l_compact = solverChoice.turbChoice[lev].compact_eddy_diffs;
+        int ncomp_diff = (l_compact) ? EddyDiff::NumCompact : EddyDiff::NumDiffs;
+        eddyDiffs_lev[lev] = std::make_unique<MultiFab>(ba, dm, ncomp_diff, 2);
         eddyDiffs_lev[lev]->setVal(0.0);
+        if (l_compact) {
+            Long npts = 0;
+            for (MFIter mfi(*eddyDiffs_lev[lev]); mfi.isValid(); ++mfi) {
+                npts += mfi.fabbox().numPts();
+            }
+            ParallelDescriptor::ReduceLongSum(npts);
+            Long nbytes = npts * (EddyDiff::NumDiffs - EddyDiff::NumCompact) * Long(sizeof(Real));
+            Print() << "Compact eddy diffusivities at level " << lev << " save "
+                    << nbytes << " bytes" << std::endl;
+        }
         if(l_use_ddorf) {
             SmnSmn_lev[lev] = std::make_unique<MultiFab>( ba, dm, 1, 0 );
         } else {
@@ -512,6 +555,113 @@ ERF::update_terrain_arrays (int lev)
         make_J(geom[lev],*z_phys_nd[lev],*detJ_cc[lev]);
         make_areas(geom[lev],*z_phys_nd[lev],*ax[lev],*ay[lev],*az[lev]);
         make_zcc(geom[lev],*z_phys_nd[lev],*z_phys_cc[lev]);
+
+        if (face_metrics[lev]) {
+            make_face_metrics(geom[lev],*z_phys_nd[lev],*face_metrics[lev]);
+        }
+
+        if (solverChoice.terrain_type == TerrainType::Moving) {
+            invalidate_moving_terrain_metrics(lev);
+        }
+    }
+}
+
+/**
+ * Forget which times the moving-terrain metric sets hold, e.g. after the arrays
+ * have been (re)allocated or filled by some other route.
+ *
+ * @param[in] lev level of refinement
+ */
+void
+ERF::invalidate_moving_terrain_metrics (int lev)
+{
+    metric_time_z[lev].fill(std::numeric_limits<Real>::lowest());
+    metric_time_areas[lev].fill(std::numeric_limits<Real>::lowest());
+    metric_step_time[lev] = std::numeric_limits<Real>::lowest();
+}
+
+/**
+ * Make the moving-terrain heights, Jacobian and (optionally) areas of one MetricSet at the given time.
+ *
+ * The old-time geometry is the same for every stage of a step and each stage (or substep) starts
+ * where the previous one ended, so most requests can be met by copying from another set that
+ * already holds that time. The terrain is only rebuilt from init_custom_terrain when no set does.
+ * Before the fast substeps overwrite the old set, the start-of-step geometry is stashed so the
+ * next stage can get it back without a rebuild.
+ *
+ * @param[in] lev        level of refinement
+ * @param[in] which      MetricSet::Old, Src or New
+ * @param[in] time       time at which the metrics are needed
+ * @param[in] need_areas whether the cell face areas are needed as well
+ */
+void
+ERF::make_moving_terrain_metrics (int lev, int which, Real time, bool need_areas)
+{
+    BL_PROFILE("ERF::make_moving_terrain_metrics()");
+
+    AMREX_ALWAYS_ASSERT(which == MetricSet::Old || which == MetricSet::Src || which == MetricSet::New);
+
+    Array<MultiFab*,MetricSet::NumTypes> z_nd  = {z_phys_nd[lev].get(), z_phys_nd_src[lev].get(),
+                                                  z_phys_nd_new[lev].get(), z_phys_nd_stash[lev].get()};
+    Array<MultiFab*,MetricSet::NumTypes> detJ  = {detJ_cc[lev].get(), detJ_cc_src[lev].get(),
+                                                  detJ_cc_new[lev].get(), detJ_cc_stash[lev].get()};
+    Array<MultiFab*,MetricSet::NumTypes> areax = {ax[lev].get(), ax_src[lev].get(), ax_new[lev].get(), nullptr};
+    Array<MultiFab*,MetricSet::NumTypes> areay = {ay[lev].get(), ay_src[lev].get(), ay_new[lev].get(), nullptr};
+    Array<MultiFab*,MetricSet::NumTypes> areaz = {az[lev].get(), az_src[lev].get(), az_new[lev].get(), nullptr};
+
+    auto& t_z     = metric_time_z[lev];
+    auto& t_areas = metric_time_areas[lev];
+
+    // Heights and Jacobian
+    if (t_z[which] == time) {
+        num_metric_reuses[lev]++;
+    } else {
+        // Keep the start-of-step geometry around if nothing else holds it
+        if (which == MetricSet::Old && t_z[MetricSet::Old] == metric_step_time[lev]) {
+            bool held = false;
+            for (int n = 0; n < MetricSet::NumTypes; n++) {
+                if (n != MetricSet::Old && t_z[n] == t_z[MetricSet::Old]) { held = true; }
+            }
+            if (!held) {
+                MultiFab::Copy(*z_nd[MetricSet::Stash], *z_nd[MetricSet::Old], 0, 0, 1, z_nd[MetricSet::Old]->nGrowVect());
+                MultiFab::Copy(*detJ[MetricSet::Stash], *detJ[MetricSet::Old], 0, 0, 1, detJ[MetricSet::Old]->nGrowVect());
+                t_z[MetricSet::Stash] = t_z[MetricSet::Old];
+            }
+        }
+
+        int src = -1;
+        for (int n = 0; n < MetricSet::NumTypes; n++) {
+            if (n != which && t_z[n] == time) { src = n; break; }
+        }
+
+        if (src >= 0) {
+            MultiFab::Copy(*z_nd[which], *z_nd[src], 0, 0, 1, z_nd[which]->nGrowVect());
+            MultiFab::Copy(*detJ[which], *detJ[src], 0, 0, 1, detJ[which]->nGrowVect());
+            num_metric_reuses[lev]++;
+        } else {
+            prob->init_custom_terrain(geom[lev],*z_nd[which],time);
+            init_terrain_grid(lev,geom[lev],*z_nd[which],zlevels_stag[lev],phys_bc_type);
+            make_J(geom[lev],*z_nd[which],*detJ[which]);
+            num_metric_rebuilds[lev]++;
+        }
+        t_z[which] = time;
+    }
+
+    // Areas
+    if (need_areas && t_areas[which] != time) {
+        int src = -1;
+        for (int n = 0; n < MetricSet::Stash; n++) {
+            if (n != which && t_areas[n] == time) { src = n; break; }
+        }
+
+        if (src >= 0) {
+            MultiFab::Copy(*areax[which], *areax[src], 0, 0, 1, areax[which]->nGrowVect());
+            MultiFab::Copy(*areay[which], *areay[src], 0, 0, 1, areay[which]->nGrowVect());
+            MultiFab::Copy(*areaz[which], *areaz[src], 0, 0, 1, areaz[which]->nGrowVect());
+        } else {
+            make_areas(geom[lev],*z_nd[which],*areax[which],*areay[which],*areaz[which]);
+        }
+        t_areas[which] = time;
     }
 }
 
@@ -530,11 +680,17 @@ ERF::initialize_integrator (int lev, MultiFab& cons_mf, MultiFab& vel_mf)
     int_state.push_back(MultiFab(convert(ba,IntVect(0,1,0)), dm, 1, vel_mf.nGrow())); // ymom
     int_state.push_back(MultiFab(convert(ba,IntVect(0,0,1)), dm, 1, vel_mf.nGrow())); // zmom
 
-    mri_integrator_mem[lev] = std::make_unique<MRISplitIntegrator<Vector<MultiFab> > >(int_state);
+    mri_integrator_mem[lev] = std::make_unique<MRISplitIntegrator<Vector<MultiFab> > >(int_state,
+                                                                                      solverChoice.mri_compact_storage);
     mri_integrator_mem[lev]->setNoSubstepping((solverChoice.substepping_type[lev] == SubsteppingType::None));
     mri_integrator_mem[lev]->setAnelastic(solverChoice.anelastic[lev]);
     mri_integrator_mem[lev]->setNcompCons(ncomp_cons);
     mri_integrator_mem[lev]->setForceFirstStageSingleSubstep(solverChoice.force_stage1_single_substep);
+
+    if (solverChoice.mri_compact_storage) {
+        Real mb_saved = static_cast<Real>(mri_integrator_mem[lev]->getCompactStorageSavings()) / (1024.0*1024.0);
+        Print() << "Compact MRI storage at level " << lev << " saves " << mb_saved << " MB" << std::endl;
+    }
 }
 
 void
@@ -1,8 +1,10 @@
 #include <ERF.H>
 #include "AMReX_PlotFileUtil.H"
+#include "AMReX_AsyncOut.H"
 
 #include <iostream>
 #include <fstream>
+#include <future>
 #include <vector>
 #include <string>
 
@@ -18,8 +20,42 @@ ERF::GotoNextLine (std::istream& is)
     is.ignore(bl_ignore_max, '\n');
 }
 
+/**
+ * Block until the previous asynchronous checkpoint has been drained to disk and
+ * report how much of its I/O was hidden behind timestepping.  Plotfiles submitted
+ * after the checkpoint are not waited for, and the writes of plotfiles submitted
+ * before it are not counted as hidden checkpoint I/O.
+ */
+void
+ERF::WaitForCheckpoint () const
+{
+    if (!m_chk_drained.valid()) return;
+
+    BL_PROFILE("ERF::WaitForCheckpoint()");
+
+    Real t_start = ParallelDescriptor::second();
+    Real drained_time = m_chk_drained.get();
+    Real t_end = ParallelDescriptor::second();
+
+    // Time the background writes overlapped with other work, and the time we had to wait for them
+    Real times[3] = { m_chk_staging_time,
+                      t_end - t_start,
+                      amrex::max(amrex::min(drained_time, t_start) -
+                                 amrex::max(*m_chk_started_time, m_chk_submit_time), Real(0.0)) };
+    ParallelDescriptor::ReduceRealMax(times, 3, ParallelDescriptor::IOProcessorNumber());
+
+    Print() << "Checkpoint " << m_chk_name << " : "
+            << times[0] + times[1] << " s exposed (" << times[0] << " s staging, "
+            << times[1] << " s waiting), " << times[2] << " s hidden" << std::endl;
+}
+
 /**
  * ERF function for writing a checkpoint file.
+ *
+ * If AMReX asynchronous output is enabled (amrex.async_out = 1) the data is copied into
+ * staging MultiFabs that are handed to the background writer, so timestepping continues
+ * while the previous checkpoint drains to disk.  We wait for that checkpoint to finish
+ * before starting the next one.
  */
 void
 ERF::WriteCheckpointFile () const
@@ -34,8 +70,32 @@ ERF::WriteCheckpointFile () const
     // checkpoint file name, e.g., chk00010
     const std::string& checkpointname = Concatenate(check_file,istep[0],5);
 
+    const bool use_async = AsyncOut::UseAsyncOut();
+
+    // Only one checkpoint is in flight at a time
+    if (use_async) {
+        WaitForCheckpoint();
+
+        // Record when the background writer gets to this checkpoint, after any plotfiles ahead of it
+        auto started_time = std::make_shared<Real>(0.0);
+        AsyncOut::Submit([started_time] () { *started_time = ParallelDescriptor::second(); });
+        m_chk_started_time = started_time;
+    }
+
     Print() << "Writing native checkpoint " << checkpointname << "\n";
 
+    Real t_staging_start = ParallelDescriptor::second();
+
+    // The MultiFabs below are freshly made copies, so they can be moved into the background writer
+    auto write_mf = [use_async] (MultiFab&& mf, const std::string& name)
+    {
+        if (use_async) {
+            VisMF::AsyncWrite(std::move(mf), name);
+        } else {
+            VisMF::Write(mf, name);
+        }
+    };
+
     const int nlevels = finest_level+1;
 
     // ---- prebuild a hierarchy of directories
@@ -51,64 +111,79 @@ ERF::WriteCheckpointFile () const
     // write Header file
     if (ParallelDescriptor::IOProcessor()) {
 
-       std::string HeaderFileName(checkpointname + "/Header");
-       VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
-       std::ofstream HeaderFile;
-       HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
-       HeaderFile.open(HeaderFileName.c_str(), std::ofstream::out   |
-                                               std::ofstream::trunc |
-                                               std::ofstream::binary);
-       if( ! HeaderFile.good()) {
-           FileOpenFailed(HeaderFileName);
-       }
+        // The Header is written by the background writer too, so it gets copies of what it needs
+        Vector<BoxArray> boxArrays(nlevels);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            boxArrays[lev] = boxArray(lev);
+        }
 
-       HeaderFile.precision(17);
+        auto write_header = [=, l_finest_level = finest_level, l_istep = istep, l_dt = dt, l_t_new = t_new] ()
+        {
+            std::string HeaderFileName(checkpointname + "/Header");
+            VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+            std::ofstream HeaderFile;
+            HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+            HeaderFile.open(HeaderFileName.c_str(), std::ofstream::out   |
+                                                    std::ofstream::trunc |
+                                                    std::ofstream::binary);
+            if( ! HeaderFile.good()) {
+                FileOpenFailed(HeaderFileName);
+            }
 
-       // write out title line
-       HeaderFile << "Checkpoint file for ERF\n";
+            HeaderFile.precision(17);
 
-       // write out finest_level
-       HeaderFile << finest_level << "\n";
+            // write out title line
+            HeaderFile << "Checkpoint file for ERF\n";
 
-       // write the number of components
-       // for each variable we store
+            // write out finest_level
+            HeaderFile << l_finest_level << "\n";
 
-       // conservative, cell-centered vars
-       HeaderFile << ncomp_cons << "\n";
+            // write the number of components
+            // for each variable we store
 
-       // x-velocity on faces
-       HeaderFile << 1 << "\n";
+            // conservative, cell-centered vars
+            HeaderFile << ncomp_cons << "\n";
 
-       // y-velocity on faces
-       HeaderFile << 1 << "\n";
+            // x-velocity on faces
+            HeaderFile << 1 << "\n";
 
-       // z-velocity on faces
-       HeaderFile << 1 << "\n";
+            // y-velocity on faces
+            HeaderFile << 1 << "\n";
 
-       // write out array of istep
-       for (int i = 0; i < istep.size(); ++i) {
-           HeaderFile << istep[i] << " ";
-       }
-       HeaderFile << "\n";
+            // z-velocity on faces
+            HeaderFile << 1 << "\n";
 
-       // write out array of dt
-       for (int i = 0; i < dt.size(); ++i) {
-           HeaderFile << dt[i] << " ";
-       }
-       HeaderFile << "\n";
+            // write out array of istep
+            for (int i = 0; i < l_istep.size(); ++i) {
+                HeaderFile << l_istep[i] << " ";
+            }
+            HeaderFile << "\n";
 
-       // write out array of t_new
-       for (int i = 0; i < t_new.size(); ++i) {
-           HeaderFile << t_new[i] << " ";
-       }
-       HeaderFile << "\n";
+            // write out array of dt
+            for (int i = 0; i < l_dt.size(); ++i) {
+                HeaderFile << l_dt[i] << " ";
+            }
+            HeaderFile << "\n";
 
-       // write the BoxArray at each level
-       for (int lev = 0; lev <= finest_level; ++lev) {
-           boxArray(lev).writeOn(HeaderFile);
-           HeaderFile << '\n';
-       }
-   }
+            // write out array of t_new
+            for (int i = 0; i < l_t_new.size(); ++i) {
+                HeaderFile << l_t_new[i] << " ";
+            }
+            HeaderFile << "\n";
+
+            // write the BoxArray at each level
+            for (int lev = 0; lev <= l_finest_level; ++lev) {
+                boxArrays[lev].writeOn(HeaderFile);
+                HeaderFile << '\n';
+            }
+        };
+
+        if (use_async) {
+            AsyncOut::Submit(std::move(write_header));
+        } else {
+            write_header();
+        }
+    }
 
     // write the MultiFab data to, e.g., chk00010/Level_0/
     // Here we make copies of the MultiFab with no ghost cells
@@ -116,32 +191,32 @@ ERF::WriteCheckpointFile () const
     {
         MultiFab cons(grids[lev],dmap[lev],ncomp_cons,0);
         MultiFab::Copy(cons,vars_new[lev][Vars::cons],0,0,ncomp_cons,0);
-        VisMF::Write(cons, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Cell"));
+        write_mf(std::move(cons), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Cell"));
 
         MultiFab xvel(convert(grids[lev],IntVect(1,0,0)),dmap[lev],1,0);
         MultiFab::Copy(xvel,vars_new[lev][Vars::xvel],0,0,1,0);
-        VisMF::Write(xvel, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "XFace"));
+        write_mf(std::move(xvel), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "XFace"));
 
         MultiFab yvel(convert(grids[lev],IntVect(0,1,0)),dmap[lev],1,0);
         MultiFab::Copy(yvel,vars_new[lev][Vars::yvel],0,0,1,0);
-        VisMF::Write(yvel, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "YFace"));
+        write_mf(std::move(yvel), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "YFace"));
 
         MultiFab zvel(convert(grids[lev],IntVect(0,0,1)),dmap[lev],1,0);
         MultiFab::Copy(zvel,vars_new[lev][Vars::zvel],0,0,1,0);
-        VisMF::Write(zvel, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "ZFace"));
+        write_mf(std::move(zvel), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "ZFace"));
 
         // Note that we write the ghost cells of the base state (unlike above)
         IntVect ng = base_state[lev].nGrowVect();
         MultiFab base(grids[lev],dmap[lev],base_state[lev].nComp(),ng);
         MultiFab::Copy(base,base_state[lev],0,0,base.nComp(),ng);
-        VisMF::Write(base, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "BaseState"));
+        write_mf(std::move(base), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "BaseState"));
 
         if (solverChoice.use_terrain)  {
             // Note that we also write the ghost cells of z_phys_nd
             ng = z_phys_nd[lev]->nGrowVect();
             MultiFab z_height(convert(grids[lev],IntVect(1,1,1)),dmap[lev],1,ng);
             MultiFab::Copy(z_height,*z_phys_nd[lev],0,0,1,ng);
-            VisMF::Write(z_height, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Z_Phys_nd"));
+            write_mf(std::move(z_height), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Z_Phys_nd"));
         }
 
         // We must read and write qmoist with ghost cells because we don't directly impose BCs on these vars
@@ -155,7 +230,7 @@ ERF::WriteCheckpointFile () const
            const int ncomp = 1;
            MultiFab moist_vars(grids[lev],dmap[lev],ncomp,ng);
            MultiFab::Copy(moist_vars,*(qmoist[lev][qmoist_indices[var]]),0,0,ncomp,ng);
-           VisMF::Write(moist_vars, amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", qmoist_names[var]));
+           write_mf(std::move(moist_vars), amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", qmoist_names[var]));
         }
 
 #if defined(ERF_USE_WINDFARM)
@@ -165,7 +240,7 @@ ERF::WriteCheckpointFile () const
             ng = Nturb[lev].nGrowVect();
             MultiFab mf_Nturb(grids[lev],dmap[lev],1,ng);
             MultiFab::Copy(mf_Nturb,Nturb[lev],0,0,1,ng);
-            VisMF::Write(mf_Nturb, amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "NumTurb"));
+            write_mf(std::move(mf_Nturb), amrex::MultiFabFileFullPrefix(lev, checkpointname, "Level_", "NumTurb"));
         }
 #endif
 
@@ -177,7 +252,7 @@ ERF::WriteCheckpointFile () const
                 int nvar = lsm_data[lev][mvar]->nComp();
                 MultiFab lsm_vars(ba,dm,nvar,ng);
                 MultiFab::Copy(lsm_vars,*(lsm_data[lev][mvar]),0,0,nvar,ng);
-                VisMF::Write(lsm_vars, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "LsmVars"));
+                write_mf(std::move(lsm_vars), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "LsmVars"));
             }
         }
 
@@ -191,17 +266,17 @@ ERF::WriteCheckpointFile () const
         ng = mapfac_m[lev]->nGrowVect();
         MultiFab mf_m(ba2d,dmap[lev],1,ng);
         MultiFab::Copy(mf_m,*mapfac_m[lev],0,0,1,ng);
-        VisMF::Write(mf_m, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_m"));
+        write_mf(std::move(mf_m), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_m"));
 
         ng = mapfac_u[lev]->nGrowVect();
         MultiFab mf_u(convert(ba2d,IntVect(1,0,0)),dmap[lev],1,ng);
         MultiFab::Copy(mf_u,*mapfac_u[lev],0,0,1,ng);
-        VisMF::Write(mf_u, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_u"));
+        write_mf(std::move(mf_u), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_u"));
 
         ng = mapfac_v[lev]->nGrowVect();
         MultiFab mf_v(convert(ba2d,IntVect(0,1,0)),dmap[lev],1,ng);
         MultiFab::Copy(mf_v,*mapfac_v[lev],0,0,1,ng);
-        VisMF::Write(mf_v, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_v"));
+        write_mf(std::move(mf_v), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "MapFactor_v"));
 
         if (m_most && m_most->have_variable_sea_roughness())  {
             amrex::Print() << "Writing variable surface roughness" << std::endl;
@@ -211,10 +286,22 @@ ERF::WriteCheckpointFile () const
                 const Box& bx = mfi.growntilebox();
                 z0[mfi].copy<RunOn::Host>(*(m_most->get_z0(lev)), bx);
             }
-            VisMF::Write(z0, MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Z0"));
+            write_mf(std::move(z0), MultiFabFileFullPrefix(lev, checkpointname, "Level_", "Z0"));
         }
     }
 
+    if (use_async) {
+        // Record when the background writer has drained everything submitted above.  The writer
+        // runs its tasks in order, so this is also when the checkpoint is complete on disk.
+        auto drained = std::make_shared<std::promise<Real>>();
+        m_chk_drained = drained->get_future();
+        AsyncOut::Submit([drained] () { drained->set_value(ParallelDescriptor::second()); });
+
+        m_chk_name          = checkpointname;
+        m_chk_submit_time   = ParallelDescriptor::second();
+        m_chk_staging_time  = m_chk_submit_time - t_staging_start;
+    }
+
 #ifdef ERF_USE_PARTICLES
    particleData.Checkpoint(checkpointname);
 #endif
@@ -225,7 +312,16 @@ ERF::WriteCheckpointFile () const
 
      // Vector dimensions
      int num_time = bdy_data_xlo.size();
-     int num_var  = bdy_data_xlo[0].size();
+
+     // With nc_bdy_lazy only the snapshots in [itime_lo, itime_hi] are held and written
+     int itime_lo = 0;
+     int itime_hi = num_time-1;
+     bool write_window = (nc_bdy_lazy && init_type==InitType::Real);
+     if (write_window) {
+         while (itime_lo < itime_hi && bdy_data_xlo[itime_lo].empty()) { ++itime_lo; }
+         while (itime_hi > itime_lo && bdy_data_xlo[itime_hi].empty()) { --itime_hi; }
+     }
+     int num_var  = bdy_data_xlo[itime_lo].size();
 
      // Open header file and write to it
      std::ofstream bdy_h_file(MultiFabFileFullPrefix(0, checkpointname, "Level_", "bdy_H"));
@@ -236,15 +332,18 @@ ERF::WriteCheckpointFile () const
      bdy_h_file << bdy_time_interval << "\n";
      bdy_h_file << real_width << "\n";
      for (int ivar(0); ivar<num_var; ++ivar) {
-       bdy_h_file << bdy_data_xlo[0][ivar].box() << "\n";
-       bdy_h_file << bdy_data_xhi[0][ivar].box() << "\n";
-       bdy_h_file << bdy_data_ylo[0][ivar].box() << "\n";
-       bdy_h_file << bdy_data_yhi[0][ivar].box() << "\n";
+       bdy_h_file << bdy_data_xlo[itime_lo][ivar].box() << "\n";
+       bdy_h_file << bdy_data_xhi[itime_lo][ivar].box() << "\n";
+       bdy_h_file << bdy_data_ylo[itime_lo][ivar].box() << "\n";
+       bdy_h_file << bdy_data_yhi[itime_lo][ivar].box() << "\n";
+     }
+     if (write_window) {
+       bdy_h_file << itime_lo << " " << itime_hi << "\n";
      }
 
      // Open data file and write to it
      std::ofstream bdy_d_file(MultiFabFileFullPrefix(0, checkpointname, "Level_", "bdy_D"));
-     for (int itime(0); itime<num_time; ++itime) {
+     for (int itime(itime_lo); itime<=itime_hi; ++itime) {
        for (int ivar(0); ivar<num_var; ++ivar) {
          bdy_data_xlo[itime][ivar].writeOn(bdy_d_file,0,1);
          bdy_data_xhi[itime][ivar].writeOn(bdy_d_file,0,1);
@@ -252,6 +351,12 @@ ERF::WriteCheckpointFile () const
          bdy_data_yhi[itime][ivar].writeOn(bdy_d_file,0,1);
        }
      }
+     if (write_window) {
+       // We need these to convert the snapshots we read after restart
+       wrfbdy_MUB_fab.writeOn(bdy_d_file,0,1);
+       wrfbdy_C1H_fab.writeOn(bdy_d_file,0,1);
+       wrfbdy_C2H_fab.writeOn(bdy_d_file,0,1);
+     }
    }
 #endif
 
@@ -466,7 +571,11 @@ ERF::ReadCheckpointFile ()
         int ioproc = ParallelDescriptor::IOProcessorNumber();  // I/O rank
         int num_time;
         int num_var;
+        int itime_lo = 0;
+        int itime_hi = -1;
+        int read_window = 0;
         Vector<Box> bx_v;
+        Vector<Box> conv_bx_v(3);
         if (ParallelDescriptor::IOProcessor()) {
             // Open header file and read from it
             std::ifstream bdy_h_file(MultiFabFileFullPrefix(0, restart_chkfile, "Level_", "bdy_H"));
@@ -483,12 +592,20 @@ ERF::ReadCheckpointFile ()
                 bdy_h_file >> bx_v[4*ivar+3];
             }
 
+            // Checkpoints written with nc_bdy_lazy only hold the snapshots in the window
+            if (bdy_h_file >> itime_lo >> itime_hi) {
+                read_window = 1;
+            } else {
+                itime_lo = 0;
+                itime_hi = num_time-1;
+            }
+
             // IO size the FABs
             bdy_data_xlo.resize(num_time);
             bdy_data_xhi.resize(num_time);
             bdy_data_ylo.resize(num_time);
             bdy_data_yhi.resize(num_time);
-            for (int itime(0); itime<num_time; ++itime) {
+            for (int itime(itime_lo); itime<=itime_hi; ++itime) {
                 bdy_data_xlo[itime].resize(num_var);
                 bdy_data_xhi[itime].resize(num_var);
                 bdy_data_ylo[itime].resize(num_var);
@@ -503,7 +620,7 @@ ERF::ReadCheckpointFile ()
 
             // Open data file and read from it
             std::ifstream bdy_d_file(MultiFabFileFullPrefix(0, restart_chkfile, "Level_", "bdy_D"));
-            for (int itime(0); itime<num_time; ++itime) {
+            for (int itime(itime_lo); itime<=itime_hi; ++itime) {
                 for (int ivar(0); ivar<num_var; ++ivar) {
                     bdy_data_xlo[itime][ivar].readFrom(bdy_d_file);
                     bdy_data_xhi[itime][ivar].readFrom(bdy_d_file);
@@ -511,6 +628,14 @@ ERF::ReadCheckpointFile ()
                     bdy_data_yhi[itime][ivar].readFrom(bdy_d_file);
                 }
             }
+            if (read_window) {
+                wrfbdy_MUB_fab.readFrom(bdy_d_file);
+                wrfbdy_C1H_fab.readFrom(bdy_d_file);
+                wrfbdy_C2H_fab.readFrom(bdy_d_file);
+                conv_bx_v[0] = wrfbdy_MUB_fab.box();
+                conv_bx_v[1] = wrfbdy_C1H_fab.box();
+                conv_bx_v[2] = wrfbdy_C2H_fab.box();
+            }
         } // IO
 
         // Broadcast the data
@@ -520,6 +645,9 @@ ERF::ReadCheckpointFile ()
         ParallelDescriptor::Bcast(&real_width,1,ioproc);
         ParallelDescriptor::Bcast(&num_time,1,ioproc);
         ParallelDescriptor::Bcast(&num_var,1,ioproc);
+        ParallelDescriptor::Bcast(&itime_lo,1,ioproc);
+        ParallelDescriptor::Bcast(&itime_hi,1,ioproc);
+        ParallelDescriptor::Bcast(&read_window,1,ioproc);
 
         // Everyone size their boxes
         bx_v.resize(4*num_var);
@@ -532,7 +660,7 @@ ERF::ReadCheckpointFile ()
           bdy_data_xhi.resize(num_time);
           bdy_data_ylo.resize(num_time);
           bdy_data_yhi.resize(num_time);
-          for (int itime(0); itime<num_time; ++itime) {
+          for (int itime(itime_lo); itime<=itime_hi; ++itime) {
             bdy_data_xlo[itime].resize(num_var);
             bdy_data_xhi[itime].resize(num_var);
             bdy_data_ylo[itime].resize(num_var);
@@ -546,7 +674,7 @@ ERF::ReadCheckpointFile ()
           }
         }
 
-        for (int itime(0); itime<num_time; ++itime) {
+        for (int itime(itime_lo); itime<=itime_hi; ++itime) {
             for (int ivar(0); ivar<num_var; ++ivar) {
                 ParallelDescriptor::Bcast(bdy_data_xlo[itime][ivar].dataPtr(),bdy_data_xlo[itime][ivar].box().numPts(),ioproc);
                 ParallelDescriptor::Bcast(bdy_data_xhi[itime][ivar].dataPtr(),bdy_data_xhi[itime][ivar].box().numPts(),ioproc);
@@ -554,6 +682,22 @@ ERF::ReadCheckpointFile ()
                 ParallelDescriptor::Bcast(bdy_data_yhi[itime][ivar].dataPtr(),bdy_data_yhi[itime][ivar].box().numPts(),ioproc);
             }
         }
+
+        if (read_window) {
+            if (!nc_bdy_lazy) {
+                Print() << "Restarting from a checkpoint written with erf.nc_bdy_lazy; turning it on" << std::endl;
+                nc_bdy_lazy = true;
+            }
+            ParallelDescriptor::Bcast(conv_bx_v.dataPtr(),conv_bx_v.size(),ioproc);
+            if (!ParallelDescriptor::IOProcessor()) {
+                wrfbdy_MUB_fab.resize(conv_bx_v[0],1);
+                wrfbdy_C1H_fab.resize(conv_bx_v[1],1);
+                wrfbdy_C2H_fab.resize(conv_bx_v[2],1);
+            }
+            ParallelDescriptor::Bcast(wrfbdy_MUB_fab.dataPtr(),wrfbdy_MUB_fab.box().numPts(),ioproc);
+            ParallelDescriptor::Bcast(wrfbdy_C1H_fab.dataPtr(),wrfbdy_C1H_fab.box().numPts(),ioproc);
+            ParallelDescriptor::Bcast(wrfbdy_C2H_fab.dataPtr(),wrfbdy_C2H_fab.box().numPts(),ioproc);
+        }
     } // init real
 #endif
 }
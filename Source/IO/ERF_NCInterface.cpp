@@ -207,6 +207,21 @@ void NCVar::put (const int* dptr,
         ncid, varid, start.data(), count.data(), stride.data(), dptr));
 }
 
+/**
+ * Error-checking wrapper for NetCDF function nc_put_vara_longlong
+ *
+ * @param dptr Pointer to the data to put
+ * @param start Starting indices
+ * @param count Count sizes
+ */
+void NCVar::put (const long long* dptr,
+                 const std::vector<size_t>& start,
+                 const std::vector<size_t>& count) const
+{
+    check_nc_error(
+        nc_put_vara_longlong(ncid, varid, start.data(), count.data(), dptr));
+}
+
 /**
  * Error-checking wrapper for NetCDF function nc_put_vara_string
  *
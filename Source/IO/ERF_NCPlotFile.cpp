@@ -31,9 +31,6 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
      // total number of cells in this "domain" at this level
      std::vector<int> n_cells;
 
-     // number of points in each block at this level
-     std::vector<int> offset;
-
      // set the full IO path for NetCDF output
      std::string FullPath = dir;
      if (lev == 0) {
@@ -52,14 +49,6 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
 
      int nblocks = grids[lev].size();
      auto dm = plotMF[lev]->DistributionMap();
-     offset.reserve(nproc);
-     for(auto n = 0; n < nproc; n++) {
-         offset[n] = 0;
-     }
-     for(auto ib=0; ib<nblocks; ib++) {
-        auto npts_per_block = grids[lev][ib].length(0)*grids[lev][ib].length(1)*grids[lev][ib].length(2);
-        offset[dm[ib]] += npts_per_block;
-     }
 
      // We only do single-level writes when using NetCDF format
      int flev = lev;
@@ -79,7 +68,7 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
      n_cells.push_back(ny);
      n_cells.push_back(nz);
 
-     int num_pts = nx*ny*nz;
+     Long num_pts = subdomain.numPts();
 
      int n_data_items = plotMF[lev]->nComp();
 
@@ -96,7 +85,7 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
      ncf.put_attr("title", "ERF NetCDF Plot data output");
      ncf.def_dim(nt_name,   NC_UNLIMITED);
      ncf.def_dim(ndim_name, AMREX_SPACEDIM);
-     ncf.def_dim(np_name,   num_pts);
+     ncf.def_dim(np_name,   static_cast<size_t>(num_pts));
      ncf.def_dim(nb_name,   nblocks);
      ncf.def_dim(flev_name, flev);
 
@@ -111,9 +100,15 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
      ncf.def_var("Geom.bigend"  , NC_INT, {flev_name, ndim_name});
      ncf.def_var("CellSize"     , NC_FLOAT, {flev_name, ndim_name});
 
-     ncf.def_var("x_grid", NC_FLOAT, {np_name});
-     ncf.def_var("y_grid", NC_FLOAT, {np_name});
-     ncf.def_var("z_grid", NC_FLOAT, {np_name});
+     // Cell-centered coordinates along each axis of the subdomain
+     ncf.def_var("x_grid", NC_FLOAT, {nx_name});
+     ncf.def_var("y_grid", NC_FLOAT, {ny_name});
+     ncf.def_var("z_grid", NC_FLOAT, {nz_name});
+
+     // Box table: index extents of each block and where its points start in np_name
+     ncf.def_var("box_lo"    , NC_INT, {nb_name, ndim_name});
+     ncf.def_var("box_hi"    , NC_INT, {nb_name, ndim_name});
+     ncf.def_var("box_offset", NC_INT64, {nb_name});
 
      for (int i = 0; i < plot_var_names.size(); i++) {
          ncf.def_var(plot_var_names[i], NC_FLOAT, {np_name});
@@ -187,63 +182,95 @@ ERF::writeNCPlotFile (int lev, int which_subdomain, const std::string& dir,
       ncf.put_attr("DefaultGeometry", std::vector<int>{amrex::DefaultGeometry().Coord()});
     }
 
-    std::vector<Real> x_grid;
-    std::vector<Real> y_grid;
-    std::vector<Real> z_grid;
-    long unsigned goffset = 0;
-    long unsigned glen    = 0;
-    for (int i = 0; i < grids[lev].size(); ++i) {
-        auto box = grids[lev][i];
-        if (subdomain.contains(box)) {
-            RealBox gridloc = RealBox(grids[lev][i], geom[lev].CellSize(), geom[lev].ProbLo());
-
-            x_grid.clear(); y_grid.clear(); z_grid.clear();
-            for (auto k1 = 0; k1 < grids[lev][i].length(0); ++k1) {
-              for (auto k2 = 0; k2 < grids[lev][i].length(1); ++k2) {
-                 for (auto k3 = 0; k3 < grids[lev][i].length(2); ++k3) {
-                    x_grid.push_back(gridloc.lo(0)+geom[lev].CellSize(0)*static_cast<Real>(k1));
-                    y_grid.push_back(gridloc.lo(1)+geom[lev].CellSize(1)*static_cast<Real>(k2));
-                    z_grid.push_back(gridloc.lo(2)+geom[lev].CellSize(2)*static_cast<Real>(k3));
-                 }
-              }
+    // Write the 1D coordinate axes; each rank writes the same values collectively
+    {
+        const Real* dx  = geom[lev].CellSize();
+        const Real* plo  = geom[lev].ProbLo();
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            std::vector<Real> axis(n_cells[idim]);
+            for (int n = 0; n < n_cells[idim]; ++n) {
+                axis[n] = plo[idim] + dx[idim] * (static_cast<Real>(subdomain.smallEnd(idim) + n) + 0.5);
             }
+            const std::string axis_name = (idim == 0) ? "x_grid" : ((idim == 1) ? "y_grid" : "z_grid");
+            auto nc_axis = ncf.var(axis_name);
+            nc_axis.par_access(NC_COLLECTIVE);
+            nc_axis.put(axis.data(), {0}, {static_cast<size_t>(n_cells[idim])});
+        }
+    }
+
+    // Blocks are stored rank by rank so that all of a rank's points form one contiguous
+    // range of np_name and each variable needs only one collective write per rank
+    // The offsets index the points of the whole level, which can exceed 2^31
+    Vector<int> box_lo, box_hi;
+    Vector<Long> box_offset;
+    Vector<Long> rank_npts(nproc, 0);
+    for (int ib = 0; ib < nblocks; ++ib) {
+        if (subdomain.contains(grids[lev][ib])) {
+            rank_npts[dm[ib]] += grids[lev][ib].numPts();
+        }
+    }
+    Vector<Long> rank_start(nproc, 0);
+    for (int ip = 1; ip < nproc; ++ip) {
+        rank_start[ip] = rank_start[ip-1] + rank_npts[ip-1];
+    }
+    {
+        Vector<Long> rank_fill(rank_start);
+        box_offset.resize(nblocks, -1);
+        for (int ib = 0; ib < nblocks; ++ib) {
+            const Box& bx = grids[lev][ib];
+            for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+                box_lo.push_back(bx.smallEnd(idim));
+                box_hi.push_back(bx.bigEnd(idim));
+            }
+            if (subdomain.contains(bx)) {
+                box_offset[ib] = rank_fill[dm[ib]];
+                rank_fill[dm[ib]] += bx.numPts();
+            }
+        }
+    }
+
+    auto nc_box_lo = ncf.var("box_lo");
+    nc_box_lo.par_access(NC_COLLECTIVE);
+    nc_box_lo.put(box_lo.data(), {0, 0}, {static_cast<size_t>(nblocks), AMREX_SPACEDIM});
+
+    auto nc_box_hi = ncf.var("box_hi");
+    nc_box_hi.par_access(NC_COLLECTIVE);
+    nc_box_hi.put(box_hi.data(), {0, 0}, {static_cast<size_t>(nblocks), AMREX_SPACEDIM});
+
+    auto nc_box_offset = ncf.var("box_offset");
+    nc_box_offset.par_access(NC_COLLECTIVE);
+    nc_box_offset.put(box_offset.data(), {0}, {static_cast<size_t>(nblocks)});
+
+    // Pack this rank's blocks, in box order, into one host buffer per component
+    const int  ncomp    = plotMF[lev]->nComp();
+    const auto my_start = static_cast<size_t>(rank_start[iproc]);
+    const auto my_npts  = static_cast<size_t>(rank_npts[iproc]);
+    std::vector<Real> buffer(my_npts);
+
+    Real t_write = amrex::second();
+
+    for (int k(0); k < ncomp; ++k) {
+        size_t pos = 0;
+        for (MFIter fai(*plotMF[lev]); fai.isValid(); ++fai) {
+            const Box& box = fai.validbox();
+            if (subdomain.contains(box)) {
+                const Real* data = plotMF[lev]->get(fai).dataPtr(k);
+                const auto npts  = static_cast<size_t>(box.numPts());
+                Gpu::copy(Gpu::deviceToHost, data, data + npts, buffer.data() + pos);
+                pos += npts;
+            }
+        }
+        auto nc_plot_var = ncf.var(plot_var_names[k]);
+        nc_plot_var.par_access(NC_COLLECTIVE);
+        nc_plot_var.put(buffer.data(), {my_start}, {my_npts});
+    }
+    ncf.close();
+
+    t_write = amrex::second() - t_write;
+    ParallelDescriptor::ReduceRealMax(t_write);
 
-            goffset += glen;
-            glen = grids[lev][i].length(0)*grids[lev][i].length(1)*grids[lev][i].length(2);
-
-            auto nc_x_grid = ncf.var("x_grid");
-            auto nc_y_grid = ncf.var("y_grid");
-            auto nc_z_grid = ncf.var("z_grid");
-
-            nc_x_grid.par_access(NC_INDEPENDENT);
-            nc_y_grid.par_access(NC_INDEPENDENT);
-            nc_z_grid.par_access(NC_INDEPENDENT);
-
-            nc_x_grid.put(x_grid.data(), {goffset}, {glen});
-            nc_y_grid.put(y_grid.data(), {goffset}, {glen});
-            nc_z_grid.put(z_grid.data(), {goffset}, {glen});
-       }
-   }
-
-   size_t nfai = 0;
-   long unsigned numpts = 0;
-   const int ncomp = plotMF[lev]->nComp();
-
-   for (MFIter fai(*plotMF[lev]); fai.isValid(); ++fai) {
-       auto box = fai.validbox();
-       if (subdomain.contains(box)) {
-           numpts = box.numPts();
-           long unsigned diff = nfai*numpts;
-           for(auto ip = 1; ip <= iproc; ++ip) diff += offset[ip-1];
-
-           for (int k(0); k < ncomp; ++k) {
-              const auto *data = plotMF[lev]->get(fai).dataPtr(k);
-              auto nc_plot_var = ncf.var(plot_var_names[k]);
-              nc_plot_var.par_access(NC_INDEPENDENT);
-              nc_plot_var.put(data, {diff}, {numpts});
-           }
-           nfai++;
-       }
-   }
-   ncf.close();
+    const Real nbytes = static_cast<Real>(num_pts) * ncomp * sizeof(float);
+    Print() << "  wrote " << nbytes / (1024.0*1024.0) << " MB of plot data in " << t_write
+            << " s (" << nbytes / (1024.0*1024.0) / amrex::max(t_write, Real(1.e-12)) << " MB/s)"
+            << std::endl;
 }
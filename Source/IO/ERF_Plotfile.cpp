@@ -964,16 +964,34 @@ ERF::WritePlotFile (int which, Vector<std::string> plot_var_names)
             MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Mom_h,mf_comp,1,0);
             mf_comp ++;
         }
+
+        // With compact storage the heat diffusivities are the momentum ones scaled by 1/Pr_t
+        bool l_compact = solverChoice.turbChoice[lev].compact_eddy_diffs;
+        Real inv_Pr_t  = solverChoice.turbChoice[lev].Pr_t_inv;
         if (containerHasElement(plot_var_names, "Khv")) {
-            MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Theta_v,mf_comp,1,0);
+            if (l_compact) {
+                MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Mom_v,mf_comp,1,0);
+                mf[lev].mult(inv_Pr_t,mf_comp,1,0);
+            } else {
+                MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Theta_v,mf_comp,1,0);
+            }
             mf_comp ++;
         }
         if (containerHasElement(plot_var_names, "Khh")) {
-            MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Theta_h,mf_comp,1,0);
+            if (l_compact) {
+                MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Mom_h,mf_comp,1,0);
+                mf[lev].mult(inv_Pr_t,mf_comp,1,0);
+            } else {
+                MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::Theta_h,mf_comp,1,0);
+            }
             mf_comp ++;
         }
         if (containerHasElement(plot_var_names, "Lpbl")) {
-            MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::PBL_lengthscale,mf_comp,1,0);
+            if (l_compact) {
+                mf[lev].setVal(0.0,mf_comp,1,0);
+            } else {
+                MultiFab::Copy(mf[lev],*eddyDiffs_lev[lev],EddyDiff::PBL_lengthscale,mf_comp,1,0);
+            }
             mf_comp ++;
         }
 
@@ -1352,7 +1370,7 @@ ERF::WritePlotFile (int which, Vector<std::string> plot_var_names)
     // write additional RRTMGP data
     // TODO: currently single level only
     if (which==1 && plot_rad) {
-        rad.writePlotfile(plot_file_1, t_new[0], istep[0]);
+        rad[0]->writePlotfile(plot_file_1, t_new[0], istep[0]);
     }
 #endif
 
@@ -4,8 +4,11 @@
 #include "ERF_ReadBndryPlanes.H"
 #include "ERF_IndexDefines.H"
 #include "AMReX_MultiFabUtil.H"
+#include <AMReX_VisMF.H>
 #include "ERF_EOS.H"
 
+#include <fstream>
+
 using namespace amrex;
 
 /**
@@ -36,6 +39,107 @@ IntVect offset (const int face_dir, const int normal)
     return offset;
 }
 
+/**
+ * Read the raw face data of one boundary plane file into host memory.
+ *
+ * This parses the VisMF headers and data files directly rather than going through
+ * VisMF::Read so that it makes no MPI calls and launches no kernels, which allows it
+ * to run on a background thread while the main thread keeps time stepping.
+ *
+ * @param chkname Name of the directory holding the file at this timestep
+ * @param var_names Variables to read; the first is expected to be the density
+ */
+std::unique_ptr<BndryPlaneFiles>
+read_bndry_plane_files (const std::string& chkname,
+                        const Vector<std::string>& var_names)
+{
+    auto raw = std::make_unique<BndryPlaneFiles>();
+    raw->fabs.resize(var_names.size());
+
+    const std::string level_prefix = "Level_";
+    const int lev = 0;
+
+    for (int ivar = 0; ivar < var_names.size(); ivar++)
+    {
+        std::string filename = MultiFabFileFullPrefix(lev, chkname, level_prefix, var_names[ivar]);
+
+        for (OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            if (ori.coordDir() < 2) {
+                std::string facename = Concatenate(filename + '_', ori, 1);
+
+                std::ifstream hdr_file(facename + "_H");
+                if (!hdr_file.good()) {
+                    raw->error = "Cannot open boundary plane header " + facename + "_H";
+                    return raw;
+                }
+                VisMF::Header hdr;
+                hdr_file >> hdr;
+
+                for (int i = 0; i < hdr.m_fod.size(); i++) {
+                    std::string data_name = VisMF::DirName(facename) + hdr.m_fod[i].m_name;
+                    std::ifstream data_file(data_name, std::ios::in | std::ios::binary);
+                    data_file.seekg(hdr.m_fod[i].m_head, std::ios::beg);
+
+                    FArrayBox fab(The_Cpu_Arena());
+                    if (hdr.m_vers == VisMF::Header::Version_v1) {
+                        fab.readFrom(data_file);
+                    } else {
+                        fab.resize(grow(hdr.m_ba[i], hdr.m_ngrow), hdr.m_ncomp);
+                        RealDescriptor::convertToNativeFormat(fab.dataPtr(), fab.size(), data_file,
+                                                              hdr.m_writtenRD);
+                    }
+                    if (!data_file.good()) {
+                        raw->error = "Error reading boundary plane data from " + data_name;
+                        return raw;
+                    }
+                    raw->fabs[ivar][ori].push_back(std::move(fab));
+                }
+            }
+        }
+    }
+    return raw;
+}
+
+/**
+ * Fill the boundary register on one face either from disk or from data read in the background.
+ *
+ * @param fs Face of the boundary register to fill
+ * @param facename Name of the face data on disk
+ * @param raw Prefetched data, or nullptr on ranks that did not read any
+ * @param ivar Index of the variable in raw
+ * @param ori Face orientation
+ * @param use_raw Whether to fill from raw rather than reading from disk
+ */
+void
+fill_bndry_face (FabSet& fs,
+                 const std::string& facename,
+                 const BndryPlaneFiles* raw,
+                 const int ivar,
+                 const Orientation ori,
+                 const bool use_raw)
+{
+    if (!use_raw) {
+        fs.read(facename);
+        return;
+    }
+
+    // The register is owned by the I/O rank, which is the only rank that has read anything
+    for (MFIter mfi(fs.boxArray(), fs.DistributionMap()); mfi.isValid(); ++mfi) {
+        AMREX_ALWAYS_ASSERT(raw != nullptr);
+        const auto& src_fabs = raw->fabs[ivar][ori];
+        FArrayBox& dst = fs[mfi];
+        if (mfi.index() >= src_fabs.size() ||
+            src_fabs[mfi.index()].box()   != dst.box() ||
+            src_fabs[mfi.index()].nComp() != dst.nComp()) {
+            Abort("Boundary plane data in " + facename + " does not match the domain being run");
+        }
+        const FArrayBox& src = src_fabs[mfi.index()];
+        Gpu::copyAsync(Gpu::hostToDevice, src.dataPtr(), src.dataPtr()+src.size(), dst.dataPtr());
+    }
+    Gpu::streamSynchronize();
+}
+
 /**
  * Function in ReadBndryPlanes class for allocating space
  * for the boundary plane data ERF will need.
@@ -151,6 +255,10 @@ ReadBndryPlanes::ReadBndryPlanes (const Geometry& geom, const Real& rdOcp_in)
     // What folder will the time series of planes be read from
     pp.get("bndry_file", m_filename);
 
+    // How many files to read ahead in the background (0 means read them when needed)
+    pp.query("bndry_prefetch_depth", m_prefetch_depth);
+    AMREX_ALWAYS_ASSERT(m_prefetch_depth >= 0);
+
     is_velocity_read     = 0;
     is_density_read      = 0;
     is_temperature_read  = 0;
@@ -191,6 +299,84 @@ ReadBndryPlanes::ReadBndryPlanes (const Geometry& geom, const Real& rdOcp_in)
     m_data_interp.resize(size);
 }
 
+/**
+ * ReadBndryPlanes class destructor. Waits for any outstanding background reads
+ * and reports how long the timestep path spent reading boundary plane files.
+ */
+ReadBndryPlanes::~ReadBndryPlanes ()
+{
+    for (auto& item : m_prefetch_queue) {
+        if (item.second.valid()) { item.second.wait(); }
+    }
+    m_prefetch_queue.clear();
+
+    if (m_num_files_read > 0) {
+        Print() << "ReadBndryPlanes: read " << m_num_files_read << " boundary plane files in "
+                << m_read_time << " s on the timestep path";
+        if (m_prefetch_depth > 0) {
+            Print() << ", of which " << m_stall_time << " s was spent waiting on the background reader";
+        }
+        Print() << std::endl;
+    }
+}
+
+/**
+ * Queue background reads of every file not yet queued, up to and including index idx.
+ * Only the I/O rank reads; the other ranks get their data through the copy in read_file.
+ *
+ * @param idx Index of the last file to queue
+ */
+void ReadBndryPlanes::prefetch_files (int idx)
+{
+    idx = std::min(idx, static_cast<int>(m_in_times.size())-1);
+
+    for (int n = m_last_file_queued+1; n <= idx; n++) {
+        std::future<std::unique_ptr<BndryPlaneFiles>> fut;
+        if (ParallelDescriptor::IOProcessor()) {
+            const std::string chkname = m_filename + Concatenate("/bndry_output", m_in_timesteps[n]);
+            Vector<std::string> var_names{"density"};
+            var_names.insert(var_names.end(), m_var_names.begin(), m_var_names.end());
+            fut = std::async(std::launch::async, read_bndry_plane_files, chkname, var_names);
+        }
+        m_prefetch_queue.emplace_back(n, std::move(fut));
+        m_last_file_queued = n;
+    }
+}
+
+/**
+ * Wait for the background read of file idx and take ownership of its data.
+ * Also tops up the queue so that m_prefetch_depth files beyond idx are in flight.
+ *
+ * @param idx Index of the file to take
+ * @return The raw data on the I/O rank, nullptr on the other ranks
+ */
+std::unique_ptr<BndryPlaneFiles> ReadBndryPlanes::take_prefetched_file (int idx)
+{
+    BL_PROFILE("ERF::ReadBndryPlanes::take_prefetched_file");
+
+    prefetch_files(idx + m_prefetch_depth);
+
+    // Drop anything queued for files we have skipped past
+    while (!m_prefetch_queue.empty() && m_prefetch_queue.front().first < idx) {
+        m_prefetch_queue.pop_front();
+    }
+    AMREX_ALWAYS_ASSERT(!m_prefetch_queue.empty() && m_prefetch_queue.front().first == idx);
+
+    auto fut = std::move(m_prefetch_queue.front().second);
+    m_prefetch_queue.pop_front();
+
+    std::unique_ptr<BndryPlaneFiles> raw;
+    if (fut.valid()) {
+        Real t0 = ParallelDescriptor::second();
+        raw = fut.get();
+        m_stall_time += ParallelDescriptor::second() - t0;
+        if (!raw->error.empty()) {
+            Abort(raw->error);
+        }
+    }
+    return raw;
+}
+
 /**
  * Function in ReadBndryPlanes class for reading the external file
  * specifying time data and broadcasting this data across MPI ranks.
@@ -289,9 +475,16 @@ void ReadBndryPlanes::read_input_files (Real time,
     {
         int idx_init = 0;
         read_file(idx_init,m_data_n,m_bc_extdir_vals);
-        read_file(idx_init,m_data_interp,m_bc_extdir_vals); // We want to start with this filled
         m_tn = m_in_times[idx_init];
 
+        // We want to start with the interpolated data filled
+        for (OrientationIter oit; oit != nullptr; ++oit) {
+            auto ori = oit();
+            if (ori.coordDir() < 2) {
+                (*m_data_interp[ori])[0].copy<RunOn::Device>((*m_data_n[ori])[0]);
+            }
+        }
+
         idx_init = 1;
         read_file(idx_init,m_data_np1,m_bc_extdir_vals);
         m_tnp1 = m_in_times[idx_init];
@@ -343,6 +536,10 @@ void ReadBndryPlanes::read_file (const int idx,
                                  Vector<std::unique_ptr<PlaneVector>>& data_to_fill,
                                  Array<Array<Real, AMREX_SPACEDIM*2>,AMREX_SPACEDIM+NBCVAR_max> m_bc_extdir_vals)
 {
+    BL_PROFILE("ERF::ReadBndryPlanes::read_file");
+
+    Real t_start = ParallelDescriptor::second();
+
     const int t_step = m_in_timesteps[idx];
     const std::string chkname1 = m_filename + Concatenate("/bndry_output", t_step);
 
@@ -351,7 +548,16 @@ void ReadBndryPlanes::read_file (const int idx,
 
     const Box& domain = m_geom.Domain();
     BoxArray ba(domain);
-    DistributionMapping dm{ba};
+
+    // When prefetching, the data has been read by the I/O rank so the registers must live there
+    const bool use_raw = (m_prefetch_depth > 0);
+    std::unique_ptr<BndryPlaneFiles> raw;
+    if (use_raw) {
+        raw = take_prefetched_file(idx);
+    }
+    DistributionMapping dm = (use_raw) ?
+        DistributionMapping(Vector<int>(ba.size(), ParallelDescriptor::IOProcessorNumber())) :
+        DistributionMapping(ba);
 
     GpuArray<GpuArray<Real, AMREX_SPACEDIM*2>, AMREX_SPACEDIM+NBCVAR_max> l_bc_extdir_vals_d;
 
@@ -393,7 +599,7 @@ void ReadBndryPlanes::read_file (const int idx,
           auto ori = oit();
           if (ori.coordDir() < 2) {
               std::string facenamer = Concatenate(filenamer + '_', ori, 1);
-              bndry_r[ori].read(facenamer);
+              fill_bndry_face(bndry_r[ori], facenamer, raw.get(), 0, ori, use_raw);
           }
     }
 
@@ -434,7 +640,7 @@ void ReadBndryPlanes::read_file (const int idx,
           if (ori.coordDir() < 2) {
 
             std::string facename1 = Concatenate(filename1 + '_', ori, 1);
-            bndry[ori].read(facename1);
+            fill_bndry_face(bndry[ori], facename1, raw.get(), ivar+1, ori, use_raw);
 
             const int normal = ori.coordDir();
             const IntVect v_offset = offset(ori.faceDir(), normal);
@@ -537,4 +743,7 @@ void ReadBndryPlanes::read_file (const int idx,
           } // coordDir < 2
         } // ori
     } // var_name
+
+    m_read_time += ParallelDescriptor::second() - t_start;
+    m_num_files_read++;
 }
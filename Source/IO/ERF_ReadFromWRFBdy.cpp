@@ -7,6 +7,7 @@
 #include <string>
 #include <ctime>
 #include <atomic>
+#include <limits>
 
 #include "ERF_DataStruct.H"
 #include "ERF_NCInterface.H"
@@ -26,13 +27,23 @@ namespace WRFBdyTypes {
     };
 }
 
+/**
+ * Read the lateral boundary data from a wrfbdy file.
+ *
+ * The outer vectors are sized to hold every time in the file, but only the snapshots
+ * itime_lo through itime_hi are read and allocated; the others are left untouched.
+ * Passing a negative itime_hi reads every snapshot from itime_lo on.
+ *
+ * @return the time interval between snapshots in seconds
+ */
 Real
 read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                   Vector<Vector<FArrayBox>>& bdy_data_xlo,
                   Vector<Vector<FArrayBox>>& bdy_data_xhi,
                   Vector<Vector<FArrayBox>>& bdy_data_ylo,
                   Vector<Vector<FArrayBox>>& bdy_data_yhi,
-                  int& width, Real& start_bdy_time)
+                  int& width, Real& start_bdy_time,
+                  int itime_lo, int itime_hi)
 {
     Print() << "Loading boundary data from NetCDF file " << std::endl;
 
@@ -94,6 +105,18 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
     bdy_data_ylo.resize(ntimes);
     bdy_data_yhi.resize(ntimes);
 
+    // The snapshots we read now
+    if (itime_hi < 0 || itime_hi >= ntimes) itime_hi = ntimes-1;
+    AMREX_ALWAYS_ASSERT(0 <= itime_lo && itime_lo <= itime_hi);
+    const int ntimes_read = itime_hi - itime_lo + 1;
+
+    for (int nt = itime_lo; nt <= itime_hi; ++nt) {
+        bdy_data_xlo[nt].clear();
+        bdy_data_xhi[nt].clear();
+        bdy_data_ylo[nt].clear();
+        bdy_data_yhi[nt].clear();
+    }
+
     IntVect plo(lo);
     IntVect phi(hi);
 
@@ -118,11 +141,11 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
 
     if (ParallelDescriptor::IOProcessor())
     {
-        ReadNetCDFFile(nc_bdy_file, nc_var_names, arrays);
+        ReadNetCDFFile(nc_bdy_file, nc_var_names, arrays, itime_lo, ntimes_read);
 
         // Assert that the data has the same number of time snapshots
         int itimes = static_cast<int>(arrays[0].get_vshape()[0]);
-        AMREX_ALWAYS_ASSERT(itimes == ntimes);
+        AMREX_ALWAYS_ASSERT(itimes == ntimes_read);
 
         // Width of the boundary region
         width = arrays[0].get_vshape()[1];
@@ -134,7 +157,9 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
     // This loops over every variable on every face, so nvars should be 4 * number of "ivartype" below
     for (int iv = 0; iv < nvars; iv++)
     {
-        Print() << "Building FAB for the NetCDF variable : " << nc_var_names[iv] << std::endl;
+        if (itime_lo == 0) {
+            Print() << "Building FAB for the NetCDF variable : " << nc_var_names[iv] << std::endl;
+        }
 
         int bdyVarType;
 
@@ -194,24 +219,24 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
             Box xlo_line(IntVect(lo[0], lo[1], 0), IntVect(lo[0]+width-1, hi[1], 0));
 
             if        (bdyVarType == WRFBdyVars::U) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xlo[nt].push_back(FArrayBox(xlo_plane_x_stag, 1, Arena_Used)); // U
                 }
             } else if (bdyVarType == WRFBdyVars::V) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xlo[nt].push_back(FArrayBox(xlo_plane_y_stag , 1, Arena_Used)); // V
                 }
             } else if (bdyVarType == WRFBdyVars::T) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xlo[nt].push_back(FArrayBox(xlo_plane_no_stag, 1, Arena_Used)); // T
                 }
             } else if (bdyVarType == WRFBdyVars::QV) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xlo[nt].push_back(FArrayBox(xlo_plane_no_stag, 1, Arena_Used)); // QV
                 }
             } else if (bdyVarType == WRFBdyVars::MU ||
                        bdyVarType == WRFBdyVars::PC) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xlo[nt].push_back(FArrayBox(xlo_line, 1, Arena_Used));
                 }
             }
@@ -236,24 +261,24 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
             //Print() << "HI XBX  Y STAG " << xhi_plane_y_stag << std::endl;
 
             if        (bdyVarType == WRFBdyVars::U) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xhi[nt].push_back(FArrayBox(xhi_plane_x_stag, 1, Arena_Used)); // U
                 }
             } else if (bdyVarType == WRFBdyVars::V) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xhi[nt].push_back(FArrayBox(xhi_plane_y_stag , 1, Arena_Used)); // V
                 }
             } else if (bdyVarType == WRFBdyVars::T) {
-                    for (int nt(0); nt < ntimes; ++nt) {
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                         bdy_data_xhi[nt].push_back(FArrayBox(xhi_plane_no_stag, 1, Arena_Used)); // T
                     }
             } else if (bdyVarType == WRFBdyVars::QV) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                       bdy_data_xhi[nt].push_back(FArrayBox(xhi_plane_no_stag, 1, Arena_Used)); // QV
                 }
             } else if (bdyVarType == WRFBdyVars::MU ||
                        bdyVarType == WRFBdyVars::PC) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_xhi[nt].push_back(FArrayBox(xhi_line, 1, Arena_Used)); // MU
                 }
             }
@@ -274,24 +299,24 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
             Box ylo_line(IntVect(lo[0], lo[1], 0), IntVect(hi[0], lo[1]+width-1, 0));
 
             if        (bdyVarType == WRFBdyVars::U) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_ylo[nt].push_back(FArrayBox(ylo_plane_x_stag , 1, Arena_Used)); // U
                 }
             } else if (bdyVarType == WRFBdyVars::V) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_ylo[nt].push_back(FArrayBox(ylo_plane_y_stag, 1, Arena_Used)); // V
                 }
             } else if (bdyVarType == WRFBdyVars::T) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_ylo[nt].push_back(FArrayBox(ylo_plane_no_stag, 1, Arena_Used)); // T
                 }
             } else if (bdyVarType == WRFBdyVars::QV) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_ylo[nt].push_back(FArrayBox(ylo_plane_no_stag, 1, Arena_Used)); // QV
                 }
             } else if (bdyVarType == WRFBdyVars::MU ||
                        bdyVarType == WRFBdyVars::PC) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_ylo[nt].push_back(FArrayBox(ylo_line, 1, Arena_Used)); // PC
                 }
             }
@@ -316,24 +341,24 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
             //Print() << "HI YBX  Y STAG " << yhi_plane_y_stag << std::endl;
 
             if        (bdyVarType == WRFBdyVars::U) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_yhi[nt].push_back(FArrayBox(yhi_plane_x_stag , 1, Arena_Used)); // U
                 }
             } else if (bdyVarType == WRFBdyVars::V) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_yhi[nt].push_back(FArrayBox(yhi_plane_y_stag, 1, Arena_Used)); // V
                 }
             } else if (bdyVarType == WRFBdyVars::T) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_yhi[nt].push_back(FArrayBox(yhi_plane_no_stag, 1, Arena_Used)); // T
                 }
             } else if (bdyVarType == WRFBdyVars::QV) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_yhi[nt].push_back(FArrayBox(yhi_plane_no_stag, 1, Arena_Used)); // QV
                 }
             } else if (bdyVarType == WRFBdyVars::MU ||
                        bdyVarType == WRFBdyVars::PC) {
-                for (int nt(0); nt < ntimes; ++nt) {
+                for (int nt(itime_lo); nt <= itime_hi; ++nt) {
                     bdy_data_yhi[nt].push_back(FArrayBox(yhi_line, 1, Arena_Used)); // PC
                 }
             }
@@ -357,12 +382,12 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                 int ns3 = arrays[iv].get_vshape()[3];
 
                 if (bdyType == WRFBdyTypes::x_lo) {
-                    num_pts  = bdy_data_xlo[0][bdyVarType].box().numPts();
-                    int ioff = bdy_data_xlo[0][bdyVarType].smallEnd()[0];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    num_pts  = bdy_data_xlo[itime_lo][bdyVarType].box().numPts();
+                    int ioff = bdy_data_xlo[itime_lo][bdyVarType].smallEnd()[0];
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_xlo[nt][bdyVarType].array();
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int i = n / (ns2 * ns3);
                             int k = (n - i * (ns2 * ns3)) / ns3;
@@ -371,12 +396,12 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::x_hi) {
-                    num_pts  = bdy_data_xhi[0][bdyVarType].box().numPts();
-                    int ioff = bdy_data_xhi[0][bdyVarType].bigEnd()[0];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    num_pts  = bdy_data_xhi[itime_lo][bdyVarType].box().numPts();
+                    int ioff = bdy_data_xhi[itime_lo][bdyVarType].bigEnd()[0];
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_xhi[nt][bdyVarType].array();
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int i = n / (ns2 * ns3);
                             int k = (n - i * (ns2 * ns3)) / ns3;
@@ -385,12 +410,12 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::y_lo) {
-                    num_pts  = bdy_data_ylo[0][bdyVarType].box().numPts();
-                    int joff = bdy_data_ylo[0][bdyVarType].smallEnd()[1];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    num_pts  = bdy_data_ylo[itime_lo][bdyVarType].box().numPts();
+                    int joff = bdy_data_ylo[itime_lo][bdyVarType].smallEnd()[1];
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_ylo[nt][bdyVarType].array();
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int j = n / (ns2 * ns3);
                             int k = (n - j * (ns2 * ns3)) / ns3;
@@ -399,12 +424,12 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::y_hi) {
-                    num_pts  = bdy_data_yhi[0][bdyVarType].box().numPts();
-                    int joff = bdy_data_yhi[0][bdyVarType].bigEnd()[1];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    num_pts  = bdy_data_yhi[itime_lo][bdyVarType].box().numPts();
+                    int joff = bdy_data_yhi[itime_lo][bdyVarType].bigEnd()[1];
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_yhi[nt][bdyVarType].array();
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int j = n / (ns2 * ns3);
                             int k = (n - j * (ns2 * ns3)) / ns3;
@@ -417,14 +442,14 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
             } else if (bdyVarType == WRFBdyVars::MU || bdyVarType == WRFBdyVars::PC) {
 
                 if (bdyType == WRFBdyTypes::x_lo) {
-                    num_pts  = bdy_data_xlo[0][bdyVarType].box().numPts();
-                    int ioff = bdy_data_xlo[0][bdyVarType].smallEnd()[0];
+                    num_pts  = bdy_data_xlo[itime_lo][bdyVarType].box().numPts();
+                    int ioff = bdy_data_xlo[itime_lo][bdyVarType].smallEnd()[0];
                     int ns2 = arrays[iv].get_vshape()[2];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_xlo[nt][bdyVarType].array();
 
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int i = n / ns2;
                             int j = n - i * ns2;
@@ -432,14 +457,14 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::x_hi) {
-                    num_pts  = bdy_data_xhi[0][bdyVarType].box().numPts();
-                    int ioff = bdy_data_xhi[0][bdyVarType].bigEnd()[0];
+                    num_pts  = bdy_data_xhi[itime_lo][bdyVarType].box().numPts();
+                    int ioff = bdy_data_xhi[itime_lo][bdyVarType].bigEnd()[0];
                     int ns2 = arrays[iv].get_vshape()[2];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_xhi[nt][bdyVarType].array();
 
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int i = n / ns2;
                             int j = n - i * ns2;
@@ -447,14 +472,14 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::y_lo) {
-                    num_pts  = bdy_data_ylo[0][bdyVarType].box().numPts();
-                    int joff = bdy_data_ylo[0][bdyVarType].smallEnd()[1];
+                    num_pts  = bdy_data_ylo[itime_lo][bdyVarType].box().numPts();
+                    int joff = bdy_data_ylo[itime_lo][bdyVarType].smallEnd()[1];
                     int ns2 = arrays[iv].get_vshape()[2];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_ylo[nt][bdyVarType].array();
 
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int j = n / ns2;
                             int i = n - j * ns2;
@@ -462,14 +487,14 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                         }
                     }
                 } else if (bdyType == WRFBdyTypes::y_hi) {
-                    num_pts  = bdy_data_yhi[0][bdyVarType].box().numPts();
-                    int joff = bdy_data_yhi[0][bdyVarType].bigEnd()[1];
+                    num_pts  = bdy_data_yhi[itime_lo][bdyVarType].box().numPts();
+                    int joff = bdy_data_yhi[itime_lo][bdyVarType].bigEnd()[1];
                     int ns2 = arrays[iv].get_vshape()[2];
-                    for (int nt(0); nt < ntimes; ++nt)
+                    for (int nt(itime_lo); nt <= itime_hi; ++nt)
                     {
                         fab_arr  = bdy_data_yhi[nt][bdyVarType].array();
 
-                        int n_off = nt * num_pts;
+                        int n_off = (nt - itime_lo) * num_pts;
                         for (int n(0); n < num_pts; ++n) {
                             int j = n / ns2;
                             int i = n - j * ns2;
@@ -488,7 +513,7 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
     //    filled the data in these FABs on the IOProcessor.  So here we broadcast
     //    the data to every rank.
     int n_per_time = nc_var_prefix.size();
-    for (int nt = 0; nt < ntimes; nt++)
+    for (int nt = itime_lo; nt <= itime_hi; nt++)
     {
         for (int i = 0; i < n_per_time; i++)
         {
@@ -518,15 +543,17 @@ convert_wrfbdy_data (const Box& domain,
                      const FArrayBox& NC_xvel_fab,
                      const FArrayBox& NC_yvel_fab,
                      const FArrayBox& NC_theta_fab,
-                     const FArrayBox& NC_QVAPOR_fab)
+                     const FArrayBox& NC_QVAPOR_fab,
+                     bool read_distributed,
+                     int itime_lo, int itime_hi)
 {
     // These were filled from wrfinput
     Array4<Real const> c1h_arr  = NC_C1H_fab.const_array();
     Array4<Real const> c2h_arr  = NC_C2H_fab.const_array();
     Array4<Real const> mub_arr  = NC_MUB_fab.const_array();
 
-    int ntimes = bdy_data.size();
-    for (int nt = 0; nt < ntimes; nt++)
+    // Convert only the snapshots we have just read
+    for (int nt = itime_lo; nt <= itime_hi; nt++)
     {
         Array4<Real> bdy_u_arr  = bdy_data[nt][WRFBdyVars::U].array();  // This is face-centered
         Array4<Real> bdy_v_arr  = bdy_data[nt][WRFBdyVars::V].array();
@@ -540,13 +567,42 @@ convert_wrfbdy_data (const Box& domain,
         int jhi  = domain.bigEnd()[1];
 
         if (nt==0) {
+            const int copy_vars[4] = {WRFBdyVars::U, WRFBdyVars::V, WRFBdyVars::T, WRFBdyVars::QV};
+
+            // With a distributed read each rank only holds part of the wrfinput data,
+            // so every rank fills what it has and we take the max over ranks.  Points
+            // that no rank holds keep the values read from wrfbdy.
+            const Real no_data = std::numeric_limits<Real>::lowest();
+            Vector<Gpu::HostVector<Real>> wrfbdy_h(4);
+            if (read_distributed) {
+                for (int n = 0; n < 4; ++n) {
+                    FArrayBox& bdy_fab = bdy_data[0][copy_vars[n]];
+                    wrfbdy_h[n].resize(bdy_fab.size());
+                    Gpu::copy(Gpu::deviceToHost, bdy_fab.dataPtr(), bdy_fab.dataPtr() + bdy_fab.size(), wrfbdy_h[n].begin());
+                    bdy_fab.template setVal<RunOn::Device>(no_data);
+                }
+            }
+
             bdy_data[0][WRFBdyVars::U].template  copy<RunOn::Device>(NC_xvel_fab);
             bdy_data[0][WRFBdyVars::V].template  copy<RunOn::Device>(NC_yvel_fab);
             bdy_data[0][WRFBdyVars::T].template  copy<RunOn::Device>(NC_theta_fab);
             bdy_data[0][WRFBdyVars::QV].template copy<RunOn::Device>(NC_QVAPOR_fab);
+
+            if (read_distributed) {
+                for (int n = 0; n < 4; ++n) {
+                    FArrayBox& bdy_fab = bdy_data[0][copy_vars[n]];
+                    Gpu::HostVector<Real> bdy_h(bdy_fab.size());
+                    Gpu::copy(Gpu::deviceToHost, bdy_fab.dataPtr(), bdy_fab.dataPtr() + bdy_fab.size(), bdy_h.begin());
+                    ParallelDescriptor::ReduceRealMax(bdy_h.data(), static_cast<int>(bdy_h.size()));
+                    for (Long m = 0; m < static_cast<Long>(bdy_h.size()); ++m) {
+                        if (bdy_h[m] == no_data) bdy_h[m] = wrfbdy_h[n][m];
+                    }
+                    Gpu::copy(Gpu::hostToDevice, bdy_h.begin(), bdy_h.end(), bdy_fab.dataPtr());
+                }
+            }
         } else {
             // Define u velocity
-            const auto & bx_u  = bdy_data[0][WRFBdyVars::U].box();
+            const auto & bx_u  = bdy_data[nt][WRFBdyVars::U].box();
             ParallelFor(bx_u, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
                 Real xmu;
@@ -564,7 +620,7 @@ convert_wrfbdy_data (const Box& domain,
             });
 
             // Define v velocity
-            const auto & bx_v  = bdy_data[0][WRFBdyVars::V].box();
+            const auto & bx_v  = bdy_data[nt][WRFBdyVars::V].box();
             ParallelFor(bx_v, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
                 Real xmu;
@@ -583,7 +639,7 @@ convert_wrfbdy_data (const Box& domain,
 
             // Define theta
             Real theta_ref = 300.;
-            const auto & bx_t = bdy_data[0][WRFBdyVars::T].box(); // Note this is currently "THM" aka the perturbational moist pot. temp.
+            const auto & bx_t = bdy_data[nt][WRFBdyVars::T].box(); // Note this is currently "THM" aka the perturbational moist pot. temp.
             ParallelFor(bx_t, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
                 Real xmu  = (mu_arr(i,j,0) + mub_arr(i,j,0));
@@ -599,7 +655,7 @@ convert_wrfbdy_data (const Box& domain,
             });
 
             // Define Qv
-            const auto & bx_qv = bdy_data[0][WRFBdyVars::QV].box();
+            const auto & bx_qv = bdy_data[nt][WRFBdyVars::QV].box();
             ParallelFor(bx_qv, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
                 Real xmu  = (mu_arr(i,j,0) + mub_arr(i,j,0));
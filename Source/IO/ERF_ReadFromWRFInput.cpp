@@ -31,7 +31,9 @@ read_from_wrfinput (int lev,
                     MoistureType moisture_type,
                     Real& Latitude,
                     Real& Longitude,
-                    Geometry& geom)
+                    Geometry& geom,
+                    bool read_distributed,
+                    const Vector<Box>& read_boxes)
 {
     Print() << "Loading header data from NetCDF file at level " << lev << std::endl;
 
@@ -120,7 +122,8 @@ read_from_wrfinput (int lev,
     Print() << "Building initial FABS from file " << fname << std::endl;
     BuildFABsFromNetCDFFile<FArrayBox,Real>(domain, Latitude, Longitude,
                                             Lat_var_name, Lon_var_name,
-                                            fname, NC_names, NC_dim_types, NC_fabs);
+                                            fname, NC_names, NC_dim_types, NC_fabs,
+                                            read_distributed, read_boxes);
 
 
     //
@@ -0,0 +1,485 @@
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+#include "AMReX_Math.H"
+#include "AMReX_ParmParse.H"
+#include "AMReX_Utility.H"
+#include "ERF_IndexDefines.H"
+#include "ERF_TimeSeriesSampler.H"
+
+using namespace amrex;
+
+namespace {
+
+/**
+ * Trilinear interpolation of component n of a, optionally divided by component nden,
+ * at the fractional index (sx,sy,sz) of the data's own centering
+ */
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
+Real
+ts_interp (const Array4<const Real>& a, int n, int nden,
+           Real sx, Real sy, Real sz) noexcept
+{
+    const int i0 = static_cast<int>(Math::floor(sx));
+    const int j0 = static_cast<int>(Math::floor(sy));
+    const int k0 = static_cast<int>(Math::floor(sz));
+
+    const Real wx = sx - i0;
+    const Real wy = sy - j0;
+    const Real wz = sz - k0;
+
+    Real val = 0.0;
+    for (int kk = 0; kk < 2; ++kk) {
+        for (int jj = 0; jj < 2; ++jj) {
+            for (int ii = 0; ii < 2; ++ii) {
+                const Real w = ((ii) ? wx : 1.0 - wx)
+                             * ((jj) ? wy : 1.0 - wy)
+                             * ((kk) ? wz : 1.0 - wz);
+                Real f = a(i0+ii,j0+jj,k0+kk,n);
+                if (nden >= 0) { f /= a(i0+ii,j0+jj,k0+kk,nden); }
+                val += w * f;
+            }
+        }
+    }
+    return val;
+}
+
+} // namespace
+
+/**
+ * Constructor for the TimeSeriesSampler class, which reads the probe groups from the inputs
+ *
+ *   erf.ts.samplers    = names of the groups
+ *   erf.ts.output_dir  = directory for the time-series files (default: time_series)
+ *
+ * and for each group NAME
+ *
+ *   erf.ts.NAME.type        = points, line or plane
+ *   erf.ts.NAME.locations   = x y z of each probe                      (points)
+ *   erf.ts.NAME.start / end = end points of the line                   (line)
+ *   erf.ts.NAME.origin / axis1 / axis2 = corner and edges of the plane (plane)
+ *   erf.ts.NAME.num_points  = probes along the line, or along each axis of the plane
+ *   erf.ts.NAME.fields      = any of u v w rho theta qv qc (default: u v w theta)
+ *   erf.ts.NAME.interval / per    = sampling frequency in steps / in time (default: every step)
+ *   erf.ts.NAME.buffer_size = samples held in memory between writes (default: 100)
+ *
+ * On a fresh start the data files are emptied; on restart the records written after
+ * the checkpoint are dropped so that the run continues the existing series.
+ *
+ * @param restart_step step of the checkpoint we restart from, or -1 on a fresh start
+ */
+TimeSeriesSampler::TimeSeriesSampler (int restart_step)
+{
+    ParmParse pp("erf.ts");
+
+    pp.query("output_dir", m_dir);
+
+    Vector<std::string> names;
+    pp.queryarr("samplers", names);
+
+    const std::map<std::string,TSField> field_map = {
+        {"u", TSField::u}, {"v", TSField::v}, {"w", TSField::w}, {"rho", TSField::rho},
+        {"theta", TSField::theta}, {"qv", TSField::qv}, {"qc", TSField::qc}};
+
+    m_groups.resize(names.size());
+    for (int ig = 0; ig < static_cast<int>(names.size()); ++ig) {
+        TimeSeriesGroup& grp = m_groups[ig];
+        grp.name = names[ig];
+
+        ParmParse ppg("erf.ts." + grp.name);
+
+        std::string type;
+        ppg.get("type", type);
+
+        if (type == "points") {
+            ppg.getarr("locations", grp.xyz);
+            if (grp.xyz.empty() || grp.xyz.size() % AMREX_SPACEDIM != 0) {
+                Abort("erf.ts." + grp.name + ".locations must hold x y z for each probe");
+            }
+        } else if (type == "line") {
+            Vector<Real> start, end;
+            int npts = 2;
+            ppg.getarr("start", start, 0, AMREX_SPACEDIM);
+            ppg.getarr("end"  , end  , 0, AMREX_SPACEDIM);
+            ppg.get("num_points", npts);
+            AMREX_ALWAYS_ASSERT(npts > 0);
+            for (int i = 0; i < npts; ++i) {
+                const Real s = (npts > 1) ? static_cast<Real>(i) / (npts - 1) : 0.0;
+                for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                    grp.xyz.push_back(start[d] + s * (end[d] - start[d]));
+                }
+            }
+        } else if (type == "plane") {
+            Vector<Real> origin, axis1, axis2;
+            Vector<int> npts;
+            ppg.getarr("origin", origin, 0, AMREX_SPACEDIM);
+            ppg.getarr("axis1" , axis1 , 0, AMREX_SPACEDIM);
+            ppg.getarr("axis2" , axis2 , 0, AMREX_SPACEDIM);
+            ppg.getarr("num_points", npts, 0, 2);
+            AMREX_ALWAYS_ASSERT(npts[0] > 0 && npts[1] > 0);
+            for (int j = 0; j < npts[1]; ++j) {
+                const Real s2 = (npts[1] > 1) ? static_cast<Real>(j) / (npts[1] - 1) : 0.0;
+                for (int i = 0; i < npts[0]; ++i) {
+                    const Real s1 = (npts[0] > 1) ? static_cast<Real>(i) / (npts[0] - 1) : 0.0;
+                    for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                        grp.xyz.push_back(origin[d] + s1 * axis1[d] + s2 * axis2[d]);
+                    }
+                }
+            }
+        } else {
+            Abort("erf.ts." + grp.name + ".type must be points, line or plane");
+        }
+
+        grp.field_names = {"u", "v", "w", "theta"};
+        ppg.queryarr("fields", grp.field_names);
+        for (const auto& fname : grp.field_names) {
+            auto it = field_map.find(fname);
+            if (it == field_map.end()) {
+                Abort("Unknown field " + fname + " in erf.ts." + grp.name + ".fields");
+            }
+            grp.fields.push_back(static_cast<int>(it->second));
+        }
+
+        ppg.query("interval", grp.interval);
+        ppg.query("per", grp.per);
+        if (grp.interval <= 0 && grp.per <= 0.0) { grp.interval = 1; }
+
+        ppg.query("buffer_size", grp.buffer_size);
+        grp.buffer_size = amrex::max(grp.buffer_size, 1);
+
+        grp.d_xyz.resize(grp.xyz.size());
+        Gpu::copy(Gpu::hostToDevice, grp.xyz.begin(), grp.xyz.end(), grp.d_xyz.begin());
+
+        grp.d_fields.resize(grp.fields.size());
+        Gpu::copy(Gpu::hostToDevice, grp.fields.begin(), grp.fields.end(), grp.d_fields.begin());
+
+        if (ParallelDescriptor::IOProcessor()) {
+            grp.buffer.reserve(static_cast<std::size_t>(grp.buffer_size) *
+                               (2 + static_cast<std::size_t>(grp.nprobes()) * grp.nfields()));
+        }
+    }
+
+    if (ParallelDescriptor::IOProcessor() && !m_groups.empty()) {
+        if (!UtilCreateDirectory(m_dir, 0755)) {
+            CreateDirectoryFailed(m_dir);
+        }
+        for (const auto& grp : m_groups) {
+            write_header(grp);
+            truncate_data(grp, restart_step);
+        }
+    }
+}
+
+TimeSeriesSampler::~TimeSeriesSampler ()
+{
+    flush();
+}
+
+/**
+ * Find the finest level and the grid that hold each probe, and keep the probes of the
+ * grids owned by this rank
+ *
+ * @param grp      group of probes
+ * @param nlev     number of levels
+ * @param geom     geometry at each level
+ * @param vars_new state at each level
+ */
+void
+TimeSeriesSampler::locate_probes (TimeSeriesGroup& grp, int nlev,
+                                  const Vector<Geometry>& geom,
+                                  Vector<Vector<MultiFab>>& vars_new)
+{
+    const int np = grp.nprobes();
+
+    grp.box_index.assign(nlev, Vector<int>{});
+    grp.box_offset.assign(nlev, Vector<int>{});
+    grp.d_probe_ids.resize(nlev);
+
+    // Probes of the grids owned by this rank, by level and grid
+    Vector<std::map<int,Vector<int>>> owned(nlev);
+
+    for (int p = 0; p < np; ++p) {
+        const Real* x = &grp.xyz[AMREX_SPACEDIM*p];
+        if (!geom[0].ProbDomain().contains(x)) {
+            Abort("Probe " + std::to_string(p) + " of time-series sampler " + grp.name +
+                  " is outside the domain");
+        }
+
+        for (int lev = nlev-1; lev >= 0; --lev) {
+            const Box& domain = geom[lev].Domain();
+            IntVect iv;
+            for (int d = 0; d < AMREX_SPACEDIM; ++d) {
+                iv[d] = static_cast<int>(std::floor((x[d] - geom[lev].ProbLo(d)) * geom[lev].InvCellSize(d)));
+                iv[d] = amrex::min(amrex::max(iv[d], domain.smallEnd(d)), domain.bigEnd(d));
+            }
+
+            const BoxArray& ba = vars_new[lev][Vars::cons].boxArray();
+            auto isects = ba.intersections(Box(iv,iv), true, 0);
+            if (!isects.empty()) {
+                const int K = isects[0].first;
+                if (vars_new[lev][Vars::cons].DistributionMap()[K] == ParallelDescriptor::MyProc()) {
+                    owned[lev][K].push_back(p);
+                }
+                break;
+            }
+        }
+    }
+
+    for (int lev = 0; lev < nlev; ++lev) {
+        Vector<int> ids;
+        grp.box_offset[lev].push_back(0);
+        for (const auto& [K, probes] : owned[lev]) {
+            grp.box_index[lev].push_back(K);
+            ids.insert(ids.end(), probes.begin(), probes.end());
+            grp.box_offset[lev].push_back(static_cast<int>(ids.size()));
+        }
+        grp.d_probe_ids[lev].resize(ids.size());
+        Gpu::copy(Gpu::hostToDevice, ids.begin(), ids.end(), grp.d_probe_ids[lev].begin());
+    }
+}
+
+/**
+ * Take a sample for every group that is due at this step
+ *
+ * Each probe is interpolated by the rank that owns its grid, and a single reduction per
+ * group gathers the values on the I/O rank, where they are buffered until the next write.
+ *
+ * @param nstep    number of steps taken at level 0
+ * @param time     current time
+ * @param dt       time step at level 0
+ * @param finest_level finest level of the hierarchy
+ * @param geom     geometry at each level
+ * @param vars_new state at each level
+ */
+void
+TimeSeriesSampler::sample (int nstep, Real time, Real dt, int finest_level,
+                           const Vector<Geometry>& geom,
+                           Vector<Vector<MultiFab>>& vars_new)
+{
+    BL_PROFILE("TimeSeriesSampler::sample()");
+
+    const int nlev = finest_level + 1;
+
+    // The probes are located again whenever the grids have changed
+    bool new_grids = (static_cast<int>(m_grids.size()) != nlev);
+    for (int lev = 0; lev < nlev && !new_grids; ++lev) {
+        new_grids = (m_grids[lev] != vars_new[lev][Vars::cons].boxArray()) ||
+                    (m_dmap[lev]  != vars_new[lev][Vars::cons].DistributionMap());
+    }
+    if (new_grids) {
+        m_grids.resize(nlev);
+        m_dmap.resize(nlev);
+        for (int lev = 0; lev < nlev; ++lev) {
+            m_grids[lev] = vars_new[lev][Vars::cons].boxArray();
+            m_dmap[lev]  = vars_new[lev][Vars::cons].DistributionMap();
+        }
+        for (auto& grp : m_groups) {
+            locate_probes(grp, nlev, geom, vars_new);
+        }
+    }
+
+    for (auto& grp : m_groups) {
+        bool is_due = (grp.interval > 0 && nstep % grp.interval == 0);
+        if (grp.per > 0.0) {
+            is_due = is_due || ( static_cast<int>(Math::floor((time - dt) / grp.per)) !=
+                                 static_cast<int>(Math::floor( time       / grp.per)) );
+        }
+        if (!is_due) { continue; }
+
+        const int np = grp.nprobes();
+        const int nf = grp.nfields();
+
+        Gpu::DeviceVector<Real> d_vals(static_cast<std::size_t>(np) * nf, 0.0);
+        Real*       vals = d_vals.data();
+        const Real* xyz  = grp.d_xyz.data();
+        const int*  flds = grp.d_fields.data();
+
+        for (int lev = 0; lev < nlev; ++lev) {
+            if (grp.box_index[lev].empty()) { continue; }
+
+            const MultiFab& cons = vars_new[lev][Vars::cons];
+            const MultiFab& xvel = vars_new[lev][Vars::xvel];
+            const MultiFab& yvel = vars_new[lev][Vars::yvel];
+            const MultiFab& zvel = vars_new[lev][Vars::zvel];
+
+            // The interpolation stencil reaches one cell into the ghost cells
+            AMREX_ALWAYS_ASSERT(cons.nGrow() > 0 && xvel.nGrow() > 0 &&
+                                yvel.nGrow() > 0 && zvel.nGrow() > 0);
+            const int ncomp = cons.nComp();
+
+            const auto plo   = geom[lev].ProbLoArray();
+            const auto dxinv = geom[lev].InvCellSizeArray();
+            const int* ids   = grp.d_probe_ids[lev].data();
+
+            for (int c = 0; c < static_cast<int>(grp.box_index[lev].size()); ++c) {
+                const int K   = grp.box_index[lev][c];
+                const int beg = grp.box_offset[lev][c];
+                const int cnt = grp.box_offset[lev][c+1] - beg;
+
+                const Array4<const Real>& c_arr = cons.const_array(K);
+                const Array4<const Real>& u_arr = xvel.const_array(K);
+                const Array4<const Real>& v_arr = yvel.const_array(K);
+                const Array4<const Real>& w_arr = zvel.const_array(K);
+
+                ParallelFor(cnt, [=] AMREX_GPU_DEVICE (int m) noexcept
+                {
+                    const int p = ids[beg+m];
+
+                    // Fractional index of the probe relative to the cell faces
+                    const Real sx = (xyz[AMREX_SPACEDIM*p  ] - plo[0]) * dxinv[0];
+                    const Real sy = (xyz[AMREX_SPACEDIM*p+1] - plo[1]) * dxinv[1];
+                    const Real sz = (xyz[AMREX_SPACEDIM*p+2] - plo[2]) * dxinv[2];
+
+                    for (int f = 0; f < nf; ++f) {
+                        Real val = 0.0;
+                        switch (static_cast<TSField>(flds[f])) {
+                        case TSField::u:
+                            val = ts_interp(u_arr, 0, -1, sx    , sy-0.5, sz-0.5);
+                            break;
+                        case TSField::v:
+                            val = ts_interp(v_arr, 0, -1, sx-0.5, sy    , sz-0.5);
+                            break;
+                        case TSField::w:
+                            val = ts_interp(w_arr, 0, -1, sx-0.5, sy-0.5, sz    );
+                            break;
+                        case TSField::rho:
+                            val = ts_interp(c_arr, Rho_comp, -1, sx-0.5, sy-0.5, sz-0.5);
+                            break;
+                        case TSField::theta:
+                            val = ts_interp(c_arr, RhoTheta_comp, Rho_comp, sx-0.5, sy-0.5, sz-0.5);
+                            break;
+                        case TSField::qv:
+                            val = (ncomp > RhoQ1_comp) ?
+                                  ts_interp(c_arr, RhoQ1_comp, Rho_comp, sx-0.5, sy-0.5, sz-0.5) : 0.0;
+                            break;
+                        case TSField::qc:
+                            val = (ncomp > RhoQ2_comp) ?
+                                  ts_interp(c_arr, RhoQ2_comp, Rho_comp, sx-0.5, sy-0.5, sz-0.5) : 0.0;
+                            break;
+                        }
+                        vals[p*nf+f] = val;
+                    }
+                });
+            }
+        }
+
+        // Each probe is sampled by exactly one rank, so a sum gathers all of them
+        Vector<Real> h_vals(d_vals.size());
+        Gpu::copy(Gpu::deviceToHost, d_vals.begin(), d_vals.end(), h_vals.begin());
+        ParallelDescriptor::ReduceRealSum(h_vals.data(), h_vals.size(),
+                                          ParallelDescriptor::IOProcessorNumber());
+
+        if (ParallelDescriptor::IOProcessor()) {
+            grp.buffer.push_back(static_cast<double>(time));
+            grp.buffer.push_back(static_cast<double>(nstep));
+            grp.buffer.insert(grp.buffer.end(), h_vals.begin(), h_vals.end());
+            if (++grp.nbuffered >= grp.buffer_size) {
+                flush_group(grp);
+            }
+        }
+    }
+}
+
+void
+TimeSeriesSampler::flush ()
+{
+    for (auto& grp : m_groups) {
+        flush_group(grp);
+    }
+}
+
+/**
+ * Append the buffered samples of a group to its data file
+ *
+ * @param grp group of probes
+ */
+void
+TimeSeriesSampler::flush_group (TimeSeriesGroup& grp) const
+{
+    if (!ParallelDescriptor::IOProcessor() || grp.nbuffered == 0) { return; }
+
+    BL_PROFILE("TimeSeriesSampler::flush_group()");
+
+    const std::string filename = m_dir + "/" + grp.name + ".bin";
+    std::ofstream ofs(filename, std::ios::out | std::ios::binary | std::ios::app);
+    if (!ofs.good()) {
+        FileOpenFailed(filename);
+    }
+    ofs.write(reinterpret_cast<const char*>(grp.buffer.data()),
+              static_cast<std::streamsize>(grp.buffer.size() * sizeof(double)));
+    ofs.close();
+
+    grp.buffer.clear();
+    grp.nbuffered = 0;
+}
+
+/**
+ * Empty the data file of a group, or on restart cut it back to the last record whose
+ * step is not after the restart step
+ *
+ * @param grp          group of probes
+ * @param restart_step step of the checkpoint we restart from, or -1 on a fresh start
+ */
+void
+TimeSeriesSampler::truncate_data (const TimeSeriesGroup& grp, int restart_step) const
+{
+    const std::string filename = m_dir + "/" + grp.name + ".bin";
+
+    if (restart_step < 0 || !std::filesystem::exists(filename)) {
+        std::ofstream ofs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ofs.good()) {
+            FileOpenFailed(filename);
+        }
+        return;
+    }
+
+    // Each record holds time, step and the values of each probe
+    const std::size_t rec_size = (2 + static_cast<std::size_t>(grp.nprobes()) * grp.nfields())
+                               * sizeof(double);
+    const std::size_t nrec = static_cast<std::size_t>(std::filesystem::file_size(filename)) / rec_size;
+
+    std::ifstream ifs(filename, std::ios::in | std::ios::binary);
+    if (!ifs.good()) {
+        FileOpenFailed(filename);
+    }
+    std::size_t nkeep = 0;
+    for (; nkeep < nrec; ++nkeep) {
+        double step = 0.0;
+        ifs.seekg(static_cast<std::streamoff>(nkeep * rec_size + sizeof(double)));
+        ifs.read(reinterpret_cast<char*>(&step), sizeof(double));
+        if (!ifs.good() || step > static_cast<double>(restart_step)) { break; }
+    }
+    ifs.close();
+
+    std::filesystem::resize_file(filename, nkeep * rec_size);
+}
+
+/**
+ * Write the text header that describes the data file of a group
+ *
+ * @param grp group of probes
+ */
+void
+TimeSeriesSampler::write_header (const TimeSeriesGroup& grp) const
+{
+    const std::string filename = m_dir + "/" + grp.name + ".hdr";
+    std::ofstream ofs(filename, std::ios::out | std::ios::trunc);
+    if (!ofs.good()) {
+        FileOpenFailed(filename);
+    }
+
+    ofs << "data_file " << grp.name << ".bin\n";
+    ofs << "record time step values[probe][field] (float64)\n";
+    ofs << "num_probes " << grp.nprobes() << "\n";
+    ofs << "num_fields " << grp.nfields() << "\n";
+    ofs << "fields";
+    for (const auto& fname : grp.field_names) { ofs << " " << fname; }
+    ofs << "\n";
+    ofs << "probes x y z\n";
+    ofs.precision(17);
+    for (int p = 0; p < grp.nprobes(); ++p) {
+        ofs << grp.xyz[AMREX_SPACEDIM*p] << " " << grp.xyz[AMREX_SPACEDIM*p+1] << " "
+            << grp.xyz[AMREX_SPACEDIM*p+2] << "\n";
+    }
+}
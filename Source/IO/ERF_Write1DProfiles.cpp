@@ -2,6 +2,7 @@
 
 #include "ERF.H"
 #include "ERF_EOS.H"
+#include "ERF_PlaneAverage.H"
 
 using namespace amrex;
 
@@ -213,274 +214,147 @@ ERF::derive_diag_profiles(Real /*time*/,
     bool l_use_KE   = (solverChoice.turbChoice[lev].les_type == LESType::Deardorff);
     bool l_use_QKE  = solverChoice.turbChoice[lev].use_QKE;
 
-    // This will hold rho, theta, ksgs, Kmh, Kmv, uu, uv, uw, vv, vw, ww, uth, vth, wth,
-    //                  0      1     2    3    4   5   6   7   8   9  10   11   12   13
-    //                thth, uiuiu, uiuiv, uiuiw, p, pu, pv, pw, qv, qc, qr, wqv, wqc, wqr,
-    //                  14     15     16     17 18  19  20  21  22  23  24   25   26   27
-    //                  qi, qs, qg, wthv
-    //                  28  29  30    31
-    MultiFab mf_out(grids[lev], dmap[lev], 32, 0);
+    // With compact eddy diffusivities Khv is Kmv scaled by the turbulent Prandtl number
+    bool l_compact  = solverChoice.turbChoice[lev].compact_eddy_diffs;
+    int  l_comp_Khv = (l_compact) ? EddyDiff::Mom_v : EddyDiff::Theta_v;
+    Real l_fac_Khv  = (l_compact) ? solverChoice.turbChoice[lev].Pr_t_inv : 1.0;
 
-    MultiFab mf_vels(grids[lev], dmap[lev], AMREX_SPACEDIM, 0);
-
-    MultiFab  u_cc(mf_vels, make_alias, 0, 1); // u at cell centers
-    MultiFab  v_cc(mf_vels, make_alias, 1, 1); // v at cell centers
-    MultiFab  w_cc(mf_vels, make_alias, 2, 1); // w at cell centers
-
-    average_face_to_cellcenter(mf_vels,0,
-        Array<const MultiFab*,3>{&vars_new[lev][Vars::xvel],&vars_new[lev][Vars::yvel],&vars_new[lev][Vars::zvel]});
-
-    int zdir = 2;
-    auto domain = geom[0].Domain();
-
-    // Sum in the horizontal plane
-    h_avg_u  = sumToLine(mf_vels ,0,1,domain,zdir);
-    h_avg_v  = sumToLine(mf_vels ,1,1,domain,zdir);
-    h_avg_w  = sumToLine(mf_vels ,2,1,domain,zdir);
-
-    int hu_size =  h_avg_u.size();
-
-    // Divide by the total number of cells we are averaging over
-    Real area_z = static_cast<Real>(domain.length(0)*domain.length(1));
-    for (int k = 0; k < hu_size; ++k) {
-        h_avg_u[k] /= area_z; h_avg_v[k] /= area_z; h_avg_w[k] /= area_z;
-    }
-
-    Gpu::DeviceVector<Real> d_avg_u(hu_size, Real(0.0));
-    Gpu::DeviceVector<Real> d_avg_v(hu_size, Real(0.0));
-    Gpu::DeviceVector<Real> d_avg_w(hu_size, Real(0.0));
-
-#if 0
-    auto* avg_u_ptr = d_avg_u.data();
-    auto* avg_v_ptr = d_avg_v.data();
-    auto* avg_w_ptr = d_avg_w.data();
-#endif
-
-    Gpu::copy(Gpu::hostToDevice, h_avg_u.begin(), h_avg_u.end(), d_avg_u.begin());
-    Gpu::copy(Gpu::hostToDevice, h_avg_v.begin(), h_avg_v.end(), d_avg_v.begin());
-    Gpu::copy(Gpu::hostToDevice, h_avg_w.begin(), h_avg_w.end(), d_avg_w.begin());
+    bool use_moisture = (solverChoice.moisture_type != MoistureType::None);
 
-    int nvars = vars_new[lev][Vars::cons].nComp();
-    MultiFab mf_cons(vars_new[lev][Vars::cons], make_alias, 0, nvars);
+    int n_qstate   = micro->Get_Qstate_Size();
+    int rhoqr_comp = solverChoice.RhoQr_comp;
 
-    MultiFab p_hse (base_state[lev], make_alias, 1, 1); // p_0  is second component
+    // All of the profiles are accumulated in a single pass with a single MPI reduction.
+    // The quantities are u, v, w, rho, theta, ksgs, Kmv, Khv, uu, uv, uw, vv, vw, ww,
+    //                    0  1  2    3      4     5    6    7   8   9  10  11  12  13
+    //                  uth, vth, wth, thth, uiuiu, uiuiv, uiuiw, p, pu, pv, pw,
+    //                   14   15   16    17     18     19     20 21  22  23  24
+    //                  qv, qc, qr, wqv, wqc, wqr, qi, qs, qg, wthv
+    //                  25  26  27   28   29   30  31  32  33    34
+    constexpr int nprof = 35;
+    HorizontalAverages<nprof> havg(geom[lev].Domain());
 
-    bool use_moisture = (solverChoice.moisture_type != MoistureType::None);
+    const MultiFab& mf_cons = vars_new[lev][Vars::cons];
 
     for ( MFIter mfi(mf_cons,TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        const Array4<Real>& fab_arr = mf_out.array(mfi);
-        const Array4<Real>& u_cc_arr =  u_cc.array(mfi);
-        const Array4<Real>& v_cc_arr =  v_cc.array(mfi);
-        const Array4<Real>& w_cc_arr =  w_cc.array(mfi);
-        const Array4<Real>& cons_arr = mf_cons.array(mfi);
-        const Array4<Real>&   p0_arr = p_hse.array(mfi);
-        const Array4<const Real>& eta_arr = (l_use_kturb) ? eddyDiffs_lev[lev]->const_array(mfi) :
-                                                            Array4<const Real>{};
-
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        const Array4<const Real>& u_arr    = vars_new[lev][Vars::xvel].const_array(mfi);
+        const Array4<const Real>& v_arr    = vars_new[lev][Vars::yvel].const_array(mfi);
+        const Array4<const Real>& w_arr    = vars_new[lev][Vars::zvel].const_array(mfi);
+        const Array4<const Real>& cons_arr = mf_cons.const_array(mfi);
+        const Array4<const Real>&   p0_arr = base_state[lev].const_array(mfi);
+        const Array4<const Real>& eta_arr  = (l_use_kturb) ? eddyDiffs_lev[lev]->const_array(mfi) :
+                                                             Array4<const Real>{};
+        const Array4<const Real>& qv_arr   = (use_moisture) ? qmoist[0][0]->const_array(mfi) : // TODO: Is this written only on lev 0?
+                                                              Array4<const Real>{};
+
+        havg.add(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof>& f) noexcept
         {
-            Real theta = cons_arr(i,j,k,RhoTheta_comp) / cons_arr(i,j,k,Rho_comp);
-            fab_arr(i, j, k, 0) = cons_arr(i,j,k,Rho_comp);
-            fab_arr(i, j, k, 1) = theta;
+            Real u_cc = 0.5 * (u_arr(i,j,k) + u_arr(i+1,j  ,k  ));
+            Real v_cc = 0.5 * (v_arr(i,j,k) + v_arr(i  ,j+1,k  ));
+            Real w_cc = 0.5 * (w_arr(i,j,k) + w_arr(i  ,j  ,k+1));
+
+            Real rho   = cons_arr(i,j,k,Rho_comp);
+            Real theta = cons_arr(i,j,k,RhoTheta_comp) / rho;
+
+            f[0] = u_cc;
+            f[1] = v_cc;
+            f[2] = w_cc;
+            f[3] = rho;
+            f[4] = theta;
+
             Real ksgs = 0.0;
             if (l_use_KE) {
-                ksgs = cons_arr(i,j,k,RhoKE_comp) / cons_arr(i,j,k,Rho_comp);
+                ksgs = cons_arr(i,j,k,RhoKE_comp) / rho;
             } else if (l_use_QKE) {
-                ksgs = cons_arr(i,j,k,RhoQKE_comp) / cons_arr(i,j,k,Rho_comp);
+                ksgs = cons_arr(i,j,k,RhoQKE_comp) / rho;
             }
-            fab_arr(i, j, k, 2) = ksgs;
-#if 1
+            f[5] = ksgs;
+
             if (l_use_kturb) {
-                fab_arr(i, j, k, 3) = eta_arr(i,j,k,EddyDiff::Mom_v); // Kmv
-                fab_arr(i, j, k, 4) = eta_arr(i,j,k,EddyDiff::Theta_v); // Khv
+                f[6] = eta_arr(i,j,k,EddyDiff::Mom_v);   // Kmv
+                f[7] = l_fac_Khv * eta_arr(i,j,k,l_comp_Khv); // Khv
             } else {
-                fab_arr(i, j, k, 3) = 0.0;
-                fab_arr(i, j, k, 4) = 0.0;
+                f[6] = 0.0;
+                f[7] = 0.0;
             }
-#else
-            // Here we hijack the "Kturb" variable name to print out the resolved kinetic energy
-            Real upert = u_cc_arr(i,j,k) - avg_u_ptr[k];
-            Real vpert = v_cc_arr(i,j,k) - avg_v_ptr[k];
-            Real wpert = w_cc_arr(i,j,k) - avg_w_ptr[k];
-            fab_arr(i, j, k, 3) = 0.5 * (upert*upert + vpert*vpert + wpert*wpert);
-#endif
-            fab_arr(i, j, k, 5) = u_cc_arr(i,j,k) * u_cc_arr(i,j,k);   // u*u
-            fab_arr(i, j, k, 6) = u_cc_arr(i,j,k) * v_cc_arr(i,j,k);   // u*v
-            fab_arr(i, j, k, 7) = u_cc_arr(i,j,k) * w_cc_arr(i,j,k);   // u*w
-            fab_arr(i, j, k, 8) = v_cc_arr(i,j,k) * v_cc_arr(i,j,k);   // v*v
-            fab_arr(i, j, k, 9) = v_cc_arr(i,j,k) * w_cc_arr(i,j,k);   // v*w
-            fab_arr(i, j, k,10) = w_cc_arr(i,j,k) * w_cc_arr(i,j,k);   // w*w
-            fab_arr(i, j, k,11) = u_cc_arr(i,j,k) * theta; // u*th
-            fab_arr(i, j, k,12) = v_cc_arr(i,j,k) * theta; // v*th
-            fab_arr(i, j, k,13) = w_cc_arr(i,j,k) * theta; // w*th
-            fab_arr(i, j, k,14) = theta * theta;           // th*th
-
-            // if the number of fields is changed above, then be sure to update
-            // the following def!
-            Real uiui = fab_arr(i,j,k,5) + fab_arr(i,j,k,8) + fab_arr(i,j,k,10);
-            fab_arr(i, j, k,15) = uiui * u_cc_arr(i,j,k);   // (ui*ui)*u
-            fab_arr(i, j, k,16) = uiui * v_cc_arr(i,j,k);   // (ui*ui)*v
-            fab_arr(i, j, k,17) = uiui * w_cc_arr(i,j,k);   // (ui*ui)*w
 
-            if (!use_moisture) {
-                Real p = getPgivenRTh(cons_arr(i, j, k, RhoTheta_comp));
-                p -= p0_arr(i,j,k);
-                fab_arr(i, j, k,18) = p;                       // p
-                fab_arr(i, j, k,19) = p * u_cc_arr(i,j,k);     // p*u
-                fab_arr(i, j, k,20) = p * v_cc_arr(i,j,k);     // p*v
-                fab_arr(i, j, k,21) = p * w_cc_arr(i,j,k);     // p*w
-                fab_arr(i, j, k,22) = 0.;  // qv
-                fab_arr(i, j, k,23) = 0.;  // qc
-                fab_arr(i, j, k,24) = 0.;  // qr
-                fab_arr(i, j, k,25) = 0.;  // w*qv
-                fab_arr(i, j, k,26) = 0.;  // w*qc
-                fab_arr(i, j, k,27) = 0.;  // w*qr
-                fab_arr(i, j, k,28) = 0.;  // qi
-                fab_arr(i, j, k,29) = 0.;  // qs
-                fab_arr(i, j, k,30) = 0.;  // qg
-                fab_arr(i, j, k,31) = 0.;  // w*thv
-            }
-        });
-    } // mfi
+            f[ 8] = u_cc * u_cc;   // u*u
+            f[ 9] = u_cc * v_cc;   // u*v
+            f[10] = u_cc * w_cc;   // u*w
+            f[11] = v_cc * v_cc;   // v*v
+            f[12] = v_cc * w_cc;   // v*w
+            f[13] = w_cc * w_cc;   // w*w
+            f[14] = u_cc * theta;  // u*th
+            f[15] = v_cc * theta;  // v*th
+            f[16] = w_cc * theta;  // w*th
+            f[17] = theta * theta; // th*th
+
+            Real uiui = f[8] + f[11] + f[13];
+            f[18] = uiui * u_cc;   // (ui*ui)*u
+            f[19] = uiui * v_cc;   // (ui*ui)*v
+            f[20] = uiui * w_cc;   // (ui*ui)*w
 
-    if (use_moisture)
-    {
-        int n_qstate = micro->Get_Qstate_Size();
-
-        for ( MFIter mfi(mf_cons,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-            const Box& bx = mfi.tilebox();
-            const Array4<Real>& fab_arr  = mf_out.array(mfi);
-            const Array4<Real>& cons_arr = mf_cons.array(mfi);
-            const Array4<Real>& u_cc_arr =  u_cc.array(mfi);
-            const Array4<Real>& v_cc_arr =  v_cc.array(mfi);
-            const Array4<Real>& w_cc_arr =  w_cc.array(mfi);
-            const Array4<Real>&   p0_arr = p_hse.array(mfi);
-            const Array4<Real>&   qv_arr = qmoist[0][0]->array(mfi); // TODO: Is this written only on lev 0?
-
-            int rhoqr_comp = solverChoice.RhoQr_comp;
-
-            ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-            {
-                Real p = getPgivenRTh(cons_arr(i, j, k, RhoTheta_comp), qv_arr(i,j,k));
-
-                p -= p0_arr(i,j,k);
-                fab_arr(i, j, k,18) = p;                       // p
-                fab_arr(i, j, k,19) = p * u_cc_arr(i,j,k);     // p*u
-                fab_arr(i, j, k,20) = p * v_cc_arr(i,j,k);     // p*v
-                fab_arr(i, j, k,21) = p * w_cc_arr(i,j,k);     // p*w
-                fab_arr(i, j, k,22) = cons_arr(i,j,k,RhoQ1_comp) / cons_arr(i,j,k,Rho_comp);  // qv
-                fab_arr(i, j, k,23) = cons_arr(i,j,k,RhoQ2_comp) / cons_arr(i,j,k,Rho_comp);  // qc
-                if (rhoqr_comp > -1) {
-                    fab_arr(i, j, k,24) = cons_arr(i,j,k,rhoqr_comp) / cons_arr(i,j,k,Rho_comp);  // qr
-                } else {
-                    fab_arr(i, j, k,24) = Real(0.0);
-                }
-                fab_arr(i, j, k,25) = w_cc_arr(i,j,k) * cons_arr(i,j,k,RhoQ1_comp) / cons_arr(i,j,k,Rho_comp);  // w*qv
-                fab_arr(i, j, k,26) = w_cc_arr(i,j,k) * cons_arr(i,j,k,RhoQ2_comp) / cons_arr(i,j,k,Rho_comp);  // w*qc
-                if (rhoqr_comp > -1) {
-                    fab_arr(i, j, k,27) = w_cc_arr(i,j,k) * cons_arr(i,j,k,rhoqr_comp) / cons_arr(i,j,k,Rho_comp);  // w*qr
-                } else {
-                    fab_arr(i, j, k,27) = Real(0.0);
+            if (!use_moisture) {
+                Real p = getPgivenRTh(cons_arr(i,j,k,RhoTheta_comp));
+                p -= p0_arr(i,j,k,1);
+                f[21] = p;         // p
+                f[22] = p * u_cc;  // p*u
+                f[23] = p * v_cc;  // p*v
+                f[24] = p * w_cc;  // p*w
+                for (int n = 25; n < nprof; ++n) {
+                    f[n] = 0.;     // moisture quantities
                 }
+            } else {
+                Real p = getPgivenRTh(cons_arr(i,j,k,RhoTheta_comp), qv_arr(i,j,k));
+                p -= p0_arr(i,j,k,1);
+                f[21] = p;         // p
+                f[22] = p * u_cc;  // p*u
+                f[23] = p * v_cc;  // p*v
+                f[24] = p * w_cc;  // p*w
+
+                Real qv = cons_arr(i,j,k,RhoQ1_comp) / rho;
+                Real qc = cons_arr(i,j,k,RhoQ2_comp) / rho;
+                Real qr = (rhoqr_comp > -1) ? cons_arr(i,j,k,rhoqr_comp) / rho : Real(0.0);
+                f[25] = qv;
+                f[26] = qc;
+                f[27] = qr;
+                f[28] = w_cc * qv; // w*qv
+                f[29] = w_cc * qc; // w*qc
+                f[30] = w_cc * qr; // w*qr
                 if (n_qstate > 3) {
-                    fab_arr(i, j, k,28) = cons_arr(i,j,k,RhoQ3_comp) / cons_arr(i,j,k,Rho_comp);  // qi
-                    fab_arr(i, j, k,29) = cons_arr(i,j,k,RhoQ5_comp) / cons_arr(i,j,k,Rho_comp);  // qs
-                    fab_arr(i, j, k,30) = cons_arr(i,j,k,RhoQ6_comp) / cons_arr(i,j,k,Rho_comp);  // qg
+                    f[31] = cons_arr(i,j,k,RhoQ3_comp) / rho;  // qi
+                    f[32] = cons_arr(i,j,k,RhoQ5_comp) / rho;  // qs
+                    f[33] = cons_arr(i,j,k,RhoQ6_comp) / rho;  // qg
                 } else {
-                    fab_arr(i, j, k,28) = 0.0;  // qi
-                    fab_arr(i, j, k,29) = 0.0;  // qs
-                    fab_arr(i, j, k,30) = 0.0;  // qg
+                    f[31] = 0.0;  // qi
+                    f[32] = 0.0;  // qs
+                    f[33] = 0.0;  // qg
                 }
-                Real ql = fab_arr(i, j, k,22) + fab_arr(i, j, k,23);
-                Real theta = cons_arr(i,j,k,RhoTheta_comp) / cons_arr(i,j,k,Rho_comp);
+                Real ql  = qv + qc;
                 Real thv = theta * (1 + 0.61*qv_arr(i,j,k) - ql);
-                fab_arr(i, j, k,31) = w_cc_arr(i,j,k) * thv; // w*thv
-            });
-        } // mfi
-    } // use_moisture
-
-    h_avg_rho   = sumToLine(mf_out, 0,1,domain,zdir);
-    h_avg_th    = sumToLine(mf_out, 1,1,domain,zdir);
-    h_avg_ksgs  = sumToLine(mf_out, 2,1,domain,zdir);
-    h_avg_Kmv   = sumToLine(mf_out, 3,1,domain,zdir);
-    h_avg_Khv   = sumToLine(mf_out, 4,1,domain,zdir);
-    h_avg_uu    = sumToLine(mf_out, 5,1,domain,zdir);
-    h_avg_uv    = sumToLine(mf_out, 6,1,domain,zdir);
-    h_avg_uw    = sumToLine(mf_out, 7,1,domain,zdir);
-    h_avg_vv    = sumToLine(mf_out, 8,1,domain,zdir);
-    h_avg_vw    = sumToLine(mf_out, 9,1,domain,zdir);
-    h_avg_ww    = sumToLine(mf_out,10,1,domain,zdir);
-    h_avg_uth   = sumToLine(mf_out,11,1,domain,zdir);
-    h_avg_vth   = sumToLine(mf_out,12,1,domain,zdir);
-    h_avg_wth   = sumToLine(mf_out,13,1,domain,zdir);
-    h_avg_thth  = sumToLine(mf_out,14,1,domain,zdir);
-    h_avg_uiuiu = sumToLine(mf_out,15,1,domain,zdir);
-    h_avg_uiuiv = sumToLine(mf_out,16,1,domain,zdir);
-    h_avg_uiuiw = sumToLine(mf_out,17,1,domain,zdir);
-    h_avg_p     = sumToLine(mf_out,18,1,domain,zdir);
-    h_avg_pu    = sumToLine(mf_out,19,1,domain,zdir);
-    h_avg_pv    = sumToLine(mf_out,20,1,domain,zdir);
-    h_avg_pw    = sumToLine(mf_out,21,1,domain,zdir);
-    h_avg_qv    = sumToLine(mf_out,22,1,domain,zdir);
-    h_avg_qc    = sumToLine(mf_out,23,1,domain,zdir);
-    h_avg_qr    = sumToLine(mf_out,24,1,domain,zdir);
-    h_avg_wqv   = sumToLine(mf_out,25,1,domain,zdir);
-    h_avg_wqc   = sumToLine(mf_out,26,1,domain,zdir);
-    h_avg_wqr   = sumToLine(mf_out,27,1,domain,zdir);
-    h_avg_qi    = sumToLine(mf_out,28,1,domain,zdir);
-    h_avg_qs    = sumToLine(mf_out,29,1,domain,zdir);
-    h_avg_qg    = sumToLine(mf_out,30,1,domain,zdir);
-    h_avg_wthv  = sumToLine(mf_out,31,1,domain,zdir);
-
-    // Divide by the total number of cells we are averaging over
-    int h_avg_u_size = static_cast<int>(h_avg_u.size());
-    for (int k = 0; k < h_avg_u_size; ++k) {
-        h_avg_rho[k] /= area_z;
-        h_avg_ksgs[k]  /= area_z;
-        h_avg_Kmv[k]   /= area_z;
-        h_avg_Khv[k]   /= area_z;
-        h_avg_th[k]    /= area_z;
-        h_avg_thth[k]  /= area_z;
-        h_avg_uu[k]    /= area_z;
-        h_avg_uv[k]    /= area_z;
-        h_avg_uw[k]    /= area_z;
-        h_avg_vv[k]    /= area_z;
-        h_avg_vw[k]    /= area_z;
-        h_avg_ww[k]    /= area_z;
-        h_avg_uth[k]   /= area_z;
-        h_avg_vth[k]   /= area_z;
-        h_avg_wth[k]   /= area_z;
-        h_avg_uiuiu[k] /= area_z;
-        h_avg_uiuiv[k] /= area_z;
-        h_avg_uiuiw[k] /= area_z;
-        h_avg_p[k]     /= area_z;
-        h_avg_pu[k]    /= area_z;
-        h_avg_pv[k]    /= area_z;
-        h_avg_pw[k]    /= area_z;
-        h_avg_qv[k]    /= area_z;
-        h_avg_qc[k]    /= area_z;
-        h_avg_qr[k]    /= area_z;
-        h_avg_wqv[k]   /= area_z;
-        h_avg_wqc[k]   /= area_z;
-        h_avg_wqr[k]   /= area_z;
-        h_avg_qi[k]    /= area_z;
-        h_avg_qs[k]    /= area_z;
-        h_avg_qg[k]    /= area_z;
-        h_avg_wthv[k]  /= area_z;
-    }
+                f[34] = w_cc * thv; // w*thv
+            }
+        });
+    } // mfi
 
-#if 0
-    // Here we print the integrated total kinetic energy as computed in the 1D profile above
-    Real sum = 0.;
-    Real dz = geom[0].ProbHi(2) / static_cast<Real>(h_avg_u_size);
-    for (int k = 0; k < h_avg_u_size; ++k) {
-        sum += h_avg_kturb[k] * h_avg_rho[k] * dz;
-    }
-    amrex::Print() << "ITKE " << time << " " << sum << " using " << h_avg_u_size << " " << dz << std::endl;
-#endif
+    havg.reduce();
+
+    havg.line( 0, h_avg_u    ); havg.line( 1, h_avg_v    ); havg.line( 2, h_avg_w    );
+    havg.line( 3, h_avg_rho  ); havg.line( 4, h_avg_th   ); havg.line( 5, h_avg_ksgs );
+    havg.line( 6, h_avg_Kmv  ); havg.line( 7, h_avg_Khv  );
+    havg.line( 8, h_avg_uu   ); havg.line( 9, h_avg_uv   ); havg.line(10, h_avg_uw   );
+    havg.line(11, h_avg_vv   ); havg.line(12, h_avg_vw   ); havg.line(13, h_avg_ww   );
+    havg.line(14, h_avg_uth  ); havg.line(15, h_avg_vth  ); havg.line(16, h_avg_wth  );
+    havg.line(17, h_avg_thth );
+    havg.line(18, h_avg_uiuiu); havg.line(19, h_avg_uiuiv); havg.line(20, h_avg_uiuiw);
+    havg.line(21, h_avg_p    ); havg.line(22, h_avg_pu   ); havg.line(23, h_avg_pv   );
+    havg.line(24, h_avg_pw   );
+    havg.line(25, h_avg_qv   ); havg.line(26, h_avg_qc   ); havg.line(27, h_avg_qr   );
+    havg.line(28, h_avg_wqv  ); havg.line(29, h_avg_wqc  ); havg.line(30, h_avg_wqr  );
+    havg.line(31, h_avg_qi   ); havg.line(32, h_avg_qs   ); havg.line(33, h_avg_qg   );
+    havg.line(34, h_avg_wthv );
 }
 
 void
@@ -492,15 +366,17 @@ ERF::derive_stress_profiles (Gpu::HostVector<Real>& h_avg_tau11, Gpu::HostVector
 {
     int lev = 0;
 
-    // This will hold the stress tensor components
-    MultiFab mf_out(grids[lev], dmap[lev], 10, 0);
-
     bool l_use_moist   = ( solverChoice.moisture_type != MoistureType::None );
 
-    for ( MFIter mfi(mf_out,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    // The stress tensor components, SFS fluxes and dissipation are accumulated in a single pass:
+    //     tau11, tau12, tau13, tau22, tau23, tau33, hfx3, q1fx3, q2fx3, diss
+    //         0      1      2      3      4      5     6      7      8     9
+    constexpr int nprof = 10;
+    HorizontalAverages<nprof> havg(geom[lev].Domain());
+
+    for ( MFIter mfi(vars_new[lev][Vars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        const Array4<Real>& fab_arr = mf_out.array(mfi);
 
         // NOTE: These are from the last RK stage...
         const Array4<const Real>& tau11_arr = Tau11_lev[lev]->const_array(mfi);
@@ -521,48 +397,28 @@ ERF::derive_stress_profiles (Gpu::HostVector<Real>& h_avg_tau11, Gpu::HostVector
                                                               Array4<const Real>{};
         const Array4<const Real>& diss_arr = SFS_diss_lev[lev]->const_array(mfi);
 
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        havg.add(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof>& f) noexcept
         {
-            fab_arr(i, j, k, 0) = tau11_arr(i,j,k);
-            fab_arr(i, j, k, 1) = 0.25 * ( tau12_arr(i,j  ,k) + tau12_arr(i+1,j  ,k)
-                                         + tau12_arr(i,j+1,k) + tau12_arr(i+1,j+1,k) );
-            fab_arr(i, j, k, 2) = 0.25 * ( tau13_arr(i,j,k  ) + tau13_arr(i+1,j,k)
-                                         + tau13_arr(i,j,k+1) + tau13_arr(i+1,j,k+1) );
-            fab_arr(i, j, k, 3) = tau22_arr(i,j,k);
-            fab_arr(i, j, k, 4) = 0.25 * ( tau23_arr(i,j,k  ) + tau23_arr(i,j+1,k)
-                                         + tau23_arr(i,j,k+1) + tau23_arr(i,j+1,k+1) );
-            fab_arr(i, j, k, 5) = tau33_arr(i,j,k);
-            fab_arr(i, j, k, 6) = 0.5 * ( hfx3_arr(i,j,k) + hfx3_arr(i,j,k+1) );
-            fab_arr(i, j, k, 7) = (l_use_moist) ? 0.5 * ( q1fx3_arr(i,j,k) + q1fx3_arr(i,j,k+1) ) : 0.0;
-            fab_arr(i, j, k, 8) = (l_use_moist) ? 0.5 * ( q2fx3_arr(i,j,k) + q2fx3_arr(i,j,k+1) ) : 0.0;
-            fab_arr(i, j, k, 9) =  diss_arr(i,j,k);
+            f[0] = tau11_arr(i,j,k);
+            f[1] = 0.25 * ( tau12_arr(i,j  ,k) + tau12_arr(i+1,j  ,k)
+                          + tau12_arr(i,j+1,k) + tau12_arr(i+1,j+1,k) );
+            f[2] = 0.25 * ( tau13_arr(i,j,k  ) + tau13_arr(i+1,j,k)
+                          + tau13_arr(i,j,k+1) + tau13_arr(i+1,j,k+1) );
+            f[3] = tau22_arr(i,j,k);
+            f[4] = 0.25 * ( tau23_arr(i,j,k  ) + tau23_arr(i,j+1,k)
+                          + tau23_arr(i,j,k+1) + tau23_arr(i,j+1,k+1) );
+            f[5] = tau33_arr(i,j,k);
+            f[6] = 0.5 * ( hfx3_arr(i,j,k) + hfx3_arr(i,j,k+1) );
+            f[7] = (l_use_moist) ? 0.5 * ( q1fx3_arr(i,j,k) + q1fx3_arr(i,j,k+1) ) : 0.0;
+            f[8] = (l_use_moist) ? 0.5 * ( q2fx3_arr(i,j,k) + q2fx3_arr(i,j,k+1) ) : 0.0;
+            f[9] = diss_arr(i,j,k);
         });
     }
 
-    int zdir = 2;
-    auto domain = geom[0].Domain();
-
-    h_avg_tau11 = sumToLine(mf_out,0,1,domain,zdir);
-    h_avg_tau12 = sumToLine(mf_out,1,1,domain,zdir);
-    h_avg_tau13 = sumToLine(mf_out,2,1,domain,zdir);
-    h_avg_tau22 = sumToLine(mf_out,3,1,domain,zdir);
-    h_avg_tau23 = sumToLine(mf_out,4,1,domain,zdir);
-    h_avg_tau33 = sumToLine(mf_out,5,1,domain,zdir);
-    h_avg_hfx3  = sumToLine(mf_out,6,1,domain,zdir);
-    h_avg_q1fx3 = sumToLine(mf_out,7,1,domain,zdir);
-    h_avg_q2fx3 = sumToLine(mf_out,8,1,domain,zdir);
-    h_avg_diss  = sumToLine(mf_out,9,1,domain,zdir);
-
-    int ht_size =  h_avg_tau11.size();
-
-    // Divide by the total number of cells we are averaging over
-    Real area_z = static_cast<Real>(domain.length(0)*domain.length(1));
-    for (int k = 0; k < ht_size; ++k) {
-        h_avg_tau11[k] /= area_z; h_avg_tau12[k] /= area_z; h_avg_tau13[k] /= area_z;
-        h_avg_tau22[k] /= area_z; h_avg_tau23[k] /= area_z;
-        h_avg_tau33[k] /= area_z;
-        h_avg_hfx3[k] /= area_z;
-        h_avg_q1fx3[k] /= area_z; h_avg_q2fx3[k] /= area_z;
-        h_avg_diss[k] /= area_z;
-    }
+    havg.reduce();
+
+    havg.line(0, h_avg_tau11); havg.line(1, h_avg_tau12); havg.line(2, h_avg_tau13);
+    havg.line(3, h_avg_tau22); havg.line(4, h_avg_tau23); havg.line(5, h_avg_tau33);
+    havg.line(6, h_avg_hfx3 ); havg.line(7, h_avg_q1fx3); havg.line(8, h_avg_q2fx3);
+    havg.line(9, h_avg_diss );
 }
@@ -2,6 +2,7 @@
 
 #include "ERF.H"
 #include "ERF_EOS.H"
+#include "ERF_PlaneAverage.H"
 
 using namespace amrex;
 
@@ -319,105 +320,129 @@ ERF::derive_diag_profiles_stag (Real /*time*/,
     bool l_use_KE   = (solverChoice.turbChoice[lev].les_type == LESType::Deardorff);
     bool l_use_QKE  = solverChoice.turbChoice[lev].use_QKE;
 
-    // Note: "uiui" == u_i*u_i = u*u + v*v + w*w
-    // This will hold rho, theta, ksgs, Kmh, Kmv, uu, uv, vv, uth, vth,
-    //       indices:   0      1     2    3    4   5   6   7    8    9
-    //                thth, uiuiu, uiuiv, p, pu, pv, qv, qc, qr, qi, qs, qg
-    //                  10     11     12 13  14  15  16  17  18  19  20  21
-    MultiFab mf_out(grids[lev], dmap[lev], 22, 0);
-
-    // This will hold uw, vw, ww, wth, uiuiw, pw, wqv, wqc, wqr, wthv
-    //       indices:  0   1   2    3      4   5    6    7    8     9
-    MultiFab mf_out_stag(convert(grids[lev], IntVect(0,0,1)), dmap[lev], 10, 0);
-
-    // This is only used to average u and v; w is not averaged to cell centers
-    MultiFab mf_vels(grids[lev], dmap[lev], 2, 0);
+    // With compact eddy diffusivities Khv is Kmv scaled by the turbulent Prandtl number
+    bool l_compact  = solverChoice.turbChoice[lev].compact_eddy_diffs;
+    int  l_comp_Khv = (l_compact) ? EddyDiff::Mom_v : EddyDiff::Theta_v;
+    Real l_fac_Khv  = (l_compact) ? solverChoice.turbChoice[lev].Pr_t_inv : 1.0;
 
-    MultiFab  u_cc(mf_vels, make_alias, 0, 1); // u at cell centers
-    MultiFab  v_cc(mf_vels, make_alias, 1, 1); // v at cell centers
-    MultiFab  w_fc(vars_new[lev][Vars::zvel], make_alias, 0, 1); // w at face centers (staggered)
-
-    int zdir = 2;
-    auto domain = geom[0].Domain();
-    Box stag_domain = domain;
-    stag_domain.convert(IntVect(0,0,1));
+    bool use_moisture = (solverChoice.moisture_type != MoistureType::None);
 
-    int nvars = vars_new[lev][Vars::cons].nComp();
-    MultiFab mf_cons(vars_new[lev][Vars::cons], make_alias, 0, nvars);
+    int n_qstate   = (use_moisture) ? micro->Get_Qstate_Size() : 0;
+    int rhoqr_comp = solverChoice.RhoQr_comp;
 
-    MultiFab p_hse (base_state[lev], make_alias, 1, 1); // p_0  is second component
+    Box stag_domain = surroundingNodes(geom[lev].Domain(),2);
 
-    bool use_moisture = (solverChoice.moisture_type != MoistureType::None);
+    // The profiles at cell centers and at z faces are each accumulated in a single pass
+    // with a single MPI reduction.
+    // Note: "uiui" == u_i*u_i = u*u + v*v + w*w
+    // The cell-centered quantities are u, v, rho, theta, ksgs, Kmv, Khv, uu, uv, vv,
+    //                                  0  1    2      3     4    5    6   7   8   9
+    //                                  uth, vth, thth, uiuiu, uiuiv, p, pu, pv,
+    //                                   10   11    12     13     14 15  16  17
+    //                                  qv, qc, qr, qi, qs, qg
+    //                                  18  19  20  21  22  23
+    constexpr int nprof = 24;
+    HorizontalAverages<nprof> havg(geom[lev].Domain());
+
+    // The z-face quantities are w, uw, vw, ww, wth, uiuiw, pw, wqv, wqc, wqr, wthv
+    //                           0   1   2   3    4      5   6    7    8    9    10
+    constexpr int nprof_stag = 11;
+    HorizontalAverages<nprof_stag> havg_stag(stag_domain);
+
+    const MultiFab& mf_cons = vars_new[lev][Vars::cons];
 
     for ( MFIter mfi(mf_cons,TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        const Array4<Real>& fab_arr = mf_out.array(mfi);
-        const Array4<Real>& fab_arr_stag = mf_out_stag.array(mfi);
-        const Array4<Real>& u_arr = vars_new[lev][Vars::xvel].array(mfi);
-        const Array4<Real>& v_arr = vars_new[lev][Vars::yvel].array(mfi);
-        const Array4<Real>& u_cc_arr =  u_cc.array(mfi);
-        const Array4<Real>& v_cc_arr =  v_cc.array(mfi);
-        const Array4<Real>& w_fc_arr =  w_fc.array(mfi);
-        const Array4<Real>& cons_arr = mf_cons.array(mfi);
-        const Array4<Real>&   p0_arr = p_hse.array(mfi);
-        const Array4<const Real>& eta_arr = (l_use_kturb) ? eddyDiffs_lev[lev]->const_array(mfi) :
-                                                            Array4<const Real>{};
-
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        const Array4<const Real>& u_arr    = vars_new[lev][Vars::xvel].const_array(mfi);
+        const Array4<const Real>& v_arr    = vars_new[lev][Vars::yvel].const_array(mfi);
+        const Array4<const Real>& w_arr    = vars_new[lev][Vars::zvel].const_array(mfi);
+        const Array4<const Real>& cons_arr = mf_cons.const_array(mfi);
+        const Array4<const Real>&   p0_arr = base_state[lev].const_array(mfi);
+        const Array4<const Real>& eta_arr  = (l_use_kturb) ? eddyDiffs_lev[lev]->const_array(mfi) :
+                                                             Array4<const Real>{};
+        const Array4<const Real>& qv_arr   = (use_moisture) ? qmoist[0][0]->const_array(mfi) : // TODO: Is this written only on lev 0?
+                                                              Array4<const Real>{};
+
+        havg.add(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof>& f) noexcept
         {
-            u_cc_arr(i,j,k) = 0.5 * (u_arr(i,j,k) + u_arr(i+1,j  ,k));
-            v_cc_arr(i,j,k) = 0.5 * (v_arr(i,j,k) + v_arr(i  ,j+1,k));
+            Real u_cc = 0.5 * (u_arr(i,j,k) + u_arr(i+1,j  ,k  ));
+            Real v_cc = 0.5 * (v_arr(i,j,k) + v_arr(i  ,j+1,k  ));
+            Real w_cc = 0.5 * (w_arr(i,j,k) + w_arr(i  ,j  ,k+1));
+
+            Real rho   = cons_arr(i,j,k,Rho_comp);
+            Real theta = cons_arr(i,j,k,RhoTheta_comp) / rho;
+
+            f[0] = u_cc;
+            f[1] = v_cc;
+            f[2] = rho;
+            f[3] = theta;
 
-            Real theta = cons_arr(i,j,k,RhoTheta_comp) / cons_arr(i,j,k,Rho_comp);
-            fab_arr(i, j, k, 0) = cons_arr(i,j,k,Rho_comp);
-            fab_arr(i, j, k, 1) = theta;
             Real ksgs = 0.0;
             if (l_use_KE) {
-                ksgs = cons_arr(i,j,k,RhoKE_comp) / cons_arr(i,j,k,Rho_comp);
+                ksgs = cons_arr(i,j,k,RhoKE_comp) / rho;
             } else if (l_use_QKE) {
-                ksgs = cons_arr(i,j,k,RhoQKE_comp) / cons_arr(i,j,k,Rho_comp);
+                ksgs = cons_arr(i,j,k,RhoQKE_comp) / rho;
             }
-            fab_arr(i, j, k, 2) = ksgs;
+            f[4] = ksgs;
+
             if (l_use_kturb) {
-                fab_arr(i, j, k, 3) = eta_arr(i,j,k,EddyDiff::Mom_v); // Kmv
-                fab_arr(i, j, k, 4) = eta_arr(i,j,k,EddyDiff::Theta_v); // Khv
+                f[5] = eta_arr(i,j,k,EddyDiff::Mom_v);   // Kmv
+                f[6] = l_fac_Khv * eta_arr(i,j,k,l_comp_Khv); // Khv
             } else {
-                fab_arr(i, j, k, 3) = 0.0;
-                fab_arr(i, j, k, 4) = 0.0;
+                f[5] = 0.0;
+                f[6] = 0.0;
             }
-            fab_arr(i, j, k, 5) = u_cc_arr(i,j,k) * u_cc_arr(i,j,k);   // u*u
-            fab_arr(i, j, k, 6) = u_cc_arr(i,j,k) * v_cc_arr(i,j,k);   // u*v
-            fab_arr(i, j, k, 7) = v_cc_arr(i,j,k) * v_cc_arr(i,j,k);   // v*v
-            fab_arr(i, j, k, 8) = u_cc_arr(i,j,k) * theta;             // u*th
-            fab_arr(i, j, k, 9) = v_cc_arr(i,j,k) * theta;             // v*th
-            fab_arr(i, j, k,10) = theta * theta;                       // th*th
 
-            Real wcc = 0.5 * (w_fc_arr(i,j,k) + w_fc_arr(i,j,k+1));
+            f[ 7] = u_cc * u_cc;   // u*u
+            f[ 8] = u_cc * v_cc;   // u*v
+            f[ 9] = v_cc * v_cc;   // v*v
+            f[10] = u_cc * theta;  // u*th
+            f[11] = v_cc * theta;  // v*th
+            f[12] = theta * theta; // th*th
 
-            // if the number of fields is changed above, then be sure to update
-            // the following def!
-            Real uiui = fab_arr(i,j,k,5) + fab_arr(i,j,k,7) + wcc*wcc;
-            fab_arr(i, j, k,11) = uiui * u_cc_arr(i,j,k);           // (ui*ui)*u
-            fab_arr(i, j, k,12) = uiui * v_cc_arr(i,j,k);           // (ui*ui)*v
+            Real uiui = f[7] + f[9] + w_cc*w_cc;
+            f[13] = uiui * u_cc;   // (ui*ui)*u
+            f[14] = uiui * v_cc;   // (ui*ui)*v
 
             if (!use_moisture) {
-                Real p = getPgivenRTh(cons_arr(i, j, k, RhoTheta_comp));
-                p -= p0_arr(i,j,k);
-                fab_arr(i, j, k,13) = p;                       // p
-                fab_arr(i, j, k,14) = p * u_cc_arr(i,j,k);     // p*u
-                fab_arr(i, j, k,15) = p * v_cc_arr(i,j,k);     // p*v
-                fab_arr(i, j, k,16) = 0.;  // qv
-                fab_arr(i, j, k,17) = 0.;  // qc
-                fab_arr(i, j, k,18) = 0.;  // qr
-                fab_arr(i, j, k,19) = 0.;  // qi
-                fab_arr(i, j, k,20) = 0.;  // qs
-                fab_arr(i, j, k,21) = 0.;  // qg
+                Real p = getPgivenRTh(cons_arr(i,j,k,RhoTheta_comp));
+                p -= p0_arr(i,j,k,1);
+                f[15] = p;         // p
+                f[16] = p * u_cc;  // p*u
+                f[17] = p * v_cc;  // p*v
+                for (int n = 18; n < nprof; ++n) {
+                    f[n] = 0.;     // moisture quantities
+                }
+            } else {
+                Real p = getPgivenRTh(cons_arr(i,j,k,RhoTheta_comp), qv_arr(i,j,k));
+                p -= p0_arr(i,j,k,1);
+                f[15] = p;         // p
+                f[16] = p * u_cc;  // p*u
+                f[17] = p * v_cc;  // p*v
+
+                f[18] = cons_arr(i,j,k,RhoQ1_comp) / rho;  // qv
+                f[19] = cons_arr(i,j,k,RhoQ2_comp) / rho;  // qc
+                f[20] = (rhoqr_comp > -1) ? cons_arr(i,j,k,rhoqr_comp) / rho : Real(0.0);  // qr
+                if (n_qstate > 3) { // SAM model
+                    f[21] = cons_arr(i,j,k,RhoQ3_comp) / rho;  // qi
+                    f[22] = cons_arr(i,j,k,RhoQ5_comp) / rho;  // qs
+                    f[23] = cons_arr(i,j,k,RhoQ6_comp) / rho;  // qg
+                } else {
+                    f[21] = 0.0;  // qi
+                    f[22] = 0.0;  // qs
+                    f[23] = 0.0;  // qg
+                }
             }
         });
 
-        const Box& zbx = mfi.tilebox(IntVect(0,0,1));
-        ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        // A z face shared by two vertically stacked grids is counted by the upper grid only
+        Box zbx = mfi.tilebox(IntVect(0,0,1));
+        if (zbx.bigEnd(2) == mfi.validbox().bigEnd(2)+1 && zbx.bigEnd(2) < stag_domain.bigEnd(2)) {
+            zbx.growHi(2,-1);
+        }
+
+        havg_stag.add(zbx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof_stag>& f) noexcept
         {
             // average to z faces (first to cell centers, then in z)
             Real uface = 0.25 * ( u_arr(i  ,j,k) + u_arr(i  ,j,k-1)
@@ -427,71 +452,27 @@ ERF::derive_diag_profiles_stag (Real /*time*/,
             Real theta0 = cons_arr(i,j,k  ,RhoTheta_comp) / cons_arr(i,j,k  ,Rho_comp);
             Real theta1 = cons_arr(i,j,k-1,RhoTheta_comp) / cons_arr(i,j,k-1,Rho_comp);
             Real thface = 0.5*(theta0 + theta1);
-            fab_arr_stag(i,j,k,0) =           uface * w_fc_arr(i,j,k); // u*w
-            fab_arr_stag(i,j,k,1) =           vface * w_fc_arr(i,j,k); // v*w
-            fab_arr_stag(i,j,k,2) = w_fc_arr(i,j,k) * w_fc_arr(i,j,k); // w*w
-            fab_arr_stag(i,j,k,3) =          thface * w_fc_arr(i,j,k); // th*w
-            Real uiui = uface*uface + vface*vface + fab_arr_stag(i,j,k,2);
-            fab_arr_stag(i,j,k,4) = uiui * w_fc_arr(i,j,k); // (ui*ui)*w
-            if (!use_moisture) {
-                Real p0 = getPgivenRTh(cons_arr(i, j, k  , RhoTheta_comp)) - p0_arr(i,j,k  );
-                Real p1 = getPgivenRTh(cons_arr(i, j, k-1, RhoTheta_comp)) - p0_arr(i,j,k-1);
-                Real pface = 0.5 * (p0 + p1);
-                fab_arr_stag(i,j,k,5) = pface * w_fc_arr(i,j,k);       // p*w
-                fab_arr_stag(i,j,k,6) = 0.;  // w*qv
-                fab_arr_stag(i,j,k,7) = 0.;  // w*qc
-                fab_arr_stag(i,j,k,8) = 0.;  // w*qr
-                fab_arr_stag(i,j,k,9) = 0.;  // w*thv
-            }
-        });
+            Real w = w_arr(i,j,k);
 
-    } // mfi
-
-    if (use_moisture)
-    {
-        int n_qstate = micro->Get_Qstate_Size();
+            f[0] = w;
+            f[1] = uface  * w;  // u*w
+            f[2] = vface  * w;  // v*w
+            f[3] = w      * w;  // w*w
+            f[4] = thface * w;  // th*w
+            Real uiui = uface*uface + vface*vface + w*w;
+            f[5] = uiui   * w;  // (ui*ui)*w
 
-        for ( MFIter mfi(mf_cons,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-            const Box& bx = mfi.tilebox();
-            const Array4<Real>& fab_arr  = mf_out.array(mfi);
-            const Array4<Real>& fab_arr_stag  = mf_out_stag.array(mfi);
-            const Array4<Real>& cons_arr = mf_cons.array(mfi);
-            const Array4<Real>& u_cc_arr =  u_cc.array(mfi);
-            const Array4<Real>& v_cc_arr =  v_cc.array(mfi);
-            const Array4<Real>& w_fc_arr =  w_fc.array(mfi);
-            const Array4<Real>&   p0_arr = p_hse.array(mfi);
-            const Array4<Real>&   qv_arr = qmoist[0][0]->array(mfi); // TODO: Is this written only on lev 0?
-
-            int rhoqr_comp = solverChoice.RhoQr_comp;
-
-            ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-            {
-                Real p = getPgivenRTh(cons_arr(i, j, k, RhoTheta_comp), qv_arr(i,j,k));
-
-                p -= p0_arr(i,j,k);
-                fab_arr(i, j, k,13) = p;                       // p
-                fab_arr(i, j, k,14) = p * u_cc_arr(i,j,k);     // p*u
-                fab_arr(i, j, k,15) = p * v_cc_arr(i,j,k);     // p*v
-                fab_arr(i, j, k,16) = cons_arr(i,j,k,RhoQ1_comp) / cons_arr(i,j,k,Rho_comp);  // qv
-                fab_arr(i, j, k,17) = cons_arr(i,j,k,RhoQ2_comp) / cons_arr(i,j,k,Rho_comp);  // qc
-                fab_arr(i, j, k,18) = cons_arr(i,j,k,rhoqr_comp) / cons_arr(i,j,k,Rho_comp);  // qr
-                if (n_qstate > 3) { // SAM model
-                    fab_arr(i, j, k,19) = cons_arr(i,j,k,RhoQ3_comp) / cons_arr(i,j,k,Rho_comp);  // qi
-                    fab_arr(i, j, k,20) = cons_arr(i,j,k,RhoQ5_comp) / cons_arr(i,j,k,Rho_comp);  // qs
-                    fab_arr(i, j, k,21) = cons_arr(i,j,k,RhoQ6_comp) / cons_arr(i,j,k,Rho_comp);  // qg
-                } else {
-                    fab_arr(i, j, k,19) = 0.0;  // qi
-                    fab_arr(i, j, k,20) = 0.0;  // qs
-                    fab_arr(i, j, k,21) = 0.0;  // qg
+            if (!use_moisture) {
+                Real p0 = getPgivenRTh(cons_arr(i, j, k  , RhoTheta_comp)) - p0_arr(i,j,k  ,1);
+                Real p1 = getPgivenRTh(cons_arr(i, j, k-1, RhoTheta_comp)) - p0_arr(i,j,k-1,1);
+                Real pface = 0.5 * (p0 + p1);
+                f[6] = pface * w;  // p*w
+                for (int n = 7; n < nprof_stag; ++n) {
+                    f[n] = 0.;     // moisture quantities
                 }
-            });
-
-            const Box& zbx = mfi.tilebox(IntVect(0,0,1));
-            ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-            {
-                Real p0 = getPgivenRTh(cons_arr(i, j, k  , RhoTheta_comp), qv_arr(i,j,k  )) - p0_arr(i,j,k  );
-                Real p1 = getPgivenRTh(cons_arr(i, j, k-1, RhoTheta_comp), qv_arr(i,j,k-1)) - p0_arr(i,j,k-1);
+            } else {
+                Real p0 = getPgivenRTh(cons_arr(i, j, k  , RhoTheta_comp), qv_arr(i,j,k  )) - p0_arr(i,j,k  ,1);
+                Real p1 = getPgivenRTh(cons_arr(i, j, k-1, RhoTheta_comp), qv_arr(i,j,k-1)) - p0_arr(i,j,k-1,1);
                 Real pface = 0.5 * (p0 + p1);
 
                 Real qv0 = cons_arr(i,j,k  ,RhoQ1_comp) / cons_arr(i,j,k  ,Rho_comp);
@@ -504,103 +485,36 @@ ERF::derive_diag_profiles_stag (Real /*time*/,
                 Real qcface = 0.5 * (qc0 + qc1);
                 Real qrface = 0.5 * (qr0 + qr1);
 
-                Real theta0 = cons_arr(i,j,k  ,RhoTheta_comp) / cons_arr(i,j,k  ,Rho_comp);
-                Real theta1 = cons_arr(i,j,k-1,RhoTheta_comp) / cons_arr(i,j,k-1,Rho_comp);
-                Real thface = 0.5*(theta0 + theta1);
-                Real ql = qcface + qrface;
+                Real ql  = qcface + qrface;
                 Real thv = thface * (1 + 0.61*qvface - ql);
 
-                fab_arr_stag(i,j,k,5) = pface  * w_fc_arr(i,j,k); // p*w
-                fab_arr_stag(i,j,k,6) = qvface * w_fc_arr(i,j,k); // w*qv
-                fab_arr_stag(i,j,k,7) = qcface * w_fc_arr(i,j,k); // w*qc
-                fab_arr_stag(i,j,k,8) = qrface * w_fc_arr(i,j,k); // w*qr
-                fab_arr_stag(i,j,k,9) = thv    * w_fc_arr(i,j,k); // w*thv
-            });
-        } // mfi
-    } // use_moisture
-
-    // Sum in the horizontal plane
-    h_avg_u = sumToLine(u_cc,0,1,     domain,zdir);
-    h_avg_v = sumToLine(v_cc,0,1,     domain,zdir);
-    h_avg_w = sumToLine(w_fc,0,1,stag_domain,zdir);
-
-    h_avg_rho   = sumToLine(mf_out, 0,1,domain,zdir);
-    h_avg_th    = sumToLine(mf_out, 1,1,domain,zdir);
-    h_avg_ksgs  = sumToLine(mf_out, 2,1,domain,zdir);
-    h_avg_Kmv   = sumToLine(mf_out, 3,1,domain,zdir);
-    h_avg_Khv   = sumToLine(mf_out, 4,1,domain,zdir);
-    h_avg_uu    = sumToLine(mf_out, 5,1,domain,zdir);
-    h_avg_uv    = sumToLine(mf_out, 6,1,domain,zdir);
-    h_avg_vv    = sumToLine(mf_out, 7,1,domain,zdir);
-    h_avg_uth   = sumToLine(mf_out, 8,1,domain,zdir);
-    h_avg_vth   = sumToLine(mf_out, 9,1,domain,zdir);
-    h_avg_thth  = sumToLine(mf_out,10,1,domain,zdir);
-    h_avg_uiuiu = sumToLine(mf_out,11,1,domain,zdir);
-    h_avg_uiuiv = sumToLine(mf_out,12,1,domain,zdir);
-    h_avg_p     = sumToLine(mf_out,13,1,domain,zdir);
-    h_avg_pu    = sumToLine(mf_out,14,1,domain,zdir);
-    h_avg_pv    = sumToLine(mf_out,15,1,domain,zdir);
-    h_avg_qv    = sumToLine(mf_out,16,1,domain,zdir);
-    h_avg_qc    = sumToLine(mf_out,17,1,domain,zdir);
-    h_avg_qr    = sumToLine(mf_out,18,1,domain,zdir);
-    h_avg_qi    = sumToLine(mf_out,19,1,domain,zdir);
-    h_avg_qs    = sumToLine(mf_out,20,1,domain,zdir);
-    h_avg_qg    = sumToLine(mf_out,21,1,domain,zdir);
-
-    h_avg_uw    = sumToLine(mf_out_stag,0,1,stag_domain,zdir);
-    h_avg_vw    = sumToLine(mf_out_stag,1,1,stag_domain,zdir);
-    h_avg_ww    = sumToLine(mf_out_stag,2,1,stag_domain,zdir);
-    h_avg_wth   = sumToLine(mf_out_stag,3,1,stag_domain,zdir);
-    h_avg_uiuiw = sumToLine(mf_out_stag,4,1,stag_domain,zdir);
-    h_avg_pw    = sumToLine(mf_out_stag,5,1,stag_domain,zdir);
-    h_avg_wqv   = sumToLine(mf_out_stag,6,1,stag_domain,zdir);
-    h_avg_wqc   = sumToLine(mf_out_stag,7,1,stag_domain,zdir);
-    h_avg_wqr   = sumToLine(mf_out_stag,8,1,stag_domain,zdir);
-    h_avg_wthv  = sumToLine(mf_out_stag,9,1,stag_domain,zdir);
-
-    // Divide by the total number of cells we are averaging over
-    Real area_z = static_cast<Real>(domain.length(0)*domain.length(1));
-    int unstag_size = h_avg_w.size() - 1; // _un_staggered heights
-    for (int k = 0; k < unstag_size; ++k) {
-        h_avg_u[k]     /= area_z;
-        h_avg_v[k]     /= area_z;
-        h_avg_rho[k]   /= area_z;
-        h_avg_ksgs[k]  /= area_z;
-        h_avg_Kmv[k]   /= area_z;
-        h_avg_Khv[k]   /= area_z;
-        h_avg_th[k]    /= area_z;
-        h_avg_thth[k]  /= area_z;
-        h_avg_uu[k]    /= area_z;
-        h_avg_uv[k]    /= area_z;
-        h_avg_vv[k]    /= area_z;
-        h_avg_uth[k]   /= area_z;
-        h_avg_vth[k]   /= area_z;
-        h_avg_uiuiu[k] /= area_z;
-        h_avg_uiuiv[k] /= area_z;
-        h_avg_p[k]     /= area_z;
-        h_avg_pu[k]    /= area_z;
-        h_avg_pv[k]    /= area_z;
-        h_avg_qv[k]    /= area_z;
-        h_avg_qc[k]    /= area_z;
-        h_avg_qr[k]    /= area_z;
-        h_avg_qi[k]    /= area_z;
-        h_avg_qs[k]    /= area_z;
-        h_avg_qg[k]    /= area_z;
-    }
+                f[ 6] = pface  * w;  // p*w
+                f[ 7] = qvface * w;  // w*qv
+                f[ 8] = qcface * w;  // w*qc
+                f[ 9] = qrface * w;  // w*qr
+                f[10] = thv    * w;  // w*thv
+            }
+        });
+    } // mfi
 
-    for (int k = 0; k < unstag_size+1; ++k) { // staggered heights
-        h_avg_w[k]     /= area_z;
-        h_avg_uw[k]    /= area_z;
-        h_avg_vw[k]    /= area_z;
-        h_avg_ww[k]    /= area_z;
-        h_avg_wth[k]   /= area_z;
-        h_avg_uiuiw[k] /= area_z;
-        h_avg_pw[k]    /= area_z;
-        h_avg_wqv[k]   /= area_z;
-        h_avg_wqc[k]   /= area_z;
-        h_avg_wqr[k]   /= area_z;
-        h_avg_wthv[k]  /= area_z;
-    }
+    havg.reduce();
+    havg_stag.reduce();
+
+    havg.line( 0, h_avg_u    ); havg.line( 1, h_avg_v    );
+    havg.line( 2, h_avg_rho  ); havg.line( 3, h_avg_th   ); havg.line( 4, h_avg_ksgs );
+    havg.line( 5, h_avg_Kmv  ); havg.line( 6, h_avg_Khv  );
+    havg.line( 7, h_avg_uu   ); havg.line( 8, h_avg_uv   ); havg.line( 9, h_avg_vv   );
+    havg.line(10, h_avg_uth  ); havg.line(11, h_avg_vth  ); havg.line(12, h_avg_thth );
+    havg.line(13, h_avg_uiuiu); havg.line(14, h_avg_uiuiv);
+    havg.line(15, h_avg_p    ); havg.line(16, h_avg_pu   ); havg.line(17, h_avg_pv   );
+    havg.line(18, h_avg_qv   ); havg.line(19, h_avg_qc   ); havg.line(20, h_avg_qr   );
+    havg.line(21, h_avg_qi   ); havg.line(22, h_avg_qs   ); havg.line(23, h_avg_qg   );
+
+    havg_stag.line( 0, h_avg_w    );
+    havg_stag.line( 1, h_avg_uw   ); havg_stag.line( 2, h_avg_vw   ); havg_stag.line( 3, h_avg_ww   );
+    havg_stag.line( 4, h_avg_wth  ); havg_stag.line( 5, h_avg_uiuiw); havg_stag.line( 6, h_avg_pw   );
+    havg_stag.line( 7, h_avg_wqv  ); havg_stag.line( 8, h_avg_wqc  ); havg_stag.line( 9, h_avg_wqr  );
+    havg_stag.line(10, h_avg_wthv );
 }
 
 void
@@ -612,19 +526,22 @@ ERF::derive_stress_profiles_stag (Gpu::HostVector<Real>& h_avg_tau11, Gpu::HostV
 {
     int lev = 0;
 
-    // This will hold the stress tensor components
-    MultiFab mf_out(grids[lev], dmap[lev], 10, 0);
+    bool l_use_moist   = ( solverChoice.moisture_type != MoistureType::None );
 
-    // This will hold Tau13 and Tau23
-    MultiFab mf_out_stag(convert(grids[lev], IntVect(0,0,1)), dmap[lev], 5, 0);
+    Box stag_domain = surroundingNodes(geom[lev].Domain(),2);
 
-    bool l_use_moist   = ( solverChoice.moisture_type != MoistureType::None );
+    // The cell-centered quantities tau11, tau12, tau22, tau33, diss
+    //                                  0      1      2      3     4
+    // and the z-face quantities tau13, tau23, hfx3, q1fx3, q2fx3
+    //                               0      1     2      3      4
+    // are each accumulated in a single pass with a single MPI reduction.
+    constexpr int nprof = 5;
+    HorizontalAverages<nprof> havg(geom[lev].Domain());
+    HorizontalAverages<nprof> havg_stag(stag_domain);
 
-    for ( MFIter mfi(mf_out,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    for ( MFIter mfi(vars_new[lev][Vars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
         const Box& bx = mfi.tilebox();
-        const Array4<Real>& fab_arr = mf_out.array(mfi);
-        const Array4<Real>& fab_arr_stag = mf_out_stag.array(mfi);
 
         // NOTE: These are from the last RK stage...
         const Array4<const Real>& tau11_arr = Tau11_lev[lev]->const_array(mfi);
@@ -645,72 +562,41 @@ ERF::derive_stress_profiles_stag (Gpu::HostVector<Real>& h_avg_tau11, Gpu::HostV
                                                               Array4<const Real>{};
         const Array4<const Real>& diss_arr = SFS_diss_lev[lev]->const_array(mfi);
 
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        havg.add(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof>& f) noexcept
         {
-            fab_arr(i, j, k, 0) = tau11_arr(i,j,k);
-            fab_arr(i, j, k, 1) = 0.25 * ( tau12_arr(i,j  ,k) + tau12_arr(i+1,j  ,k)
-                                         + tau12_arr(i,j+1,k) + tau12_arr(i+1,j+1,k) );
-//          fab_arr(i, j, k, 2) = 0.25 * ( tau13_arr(i,j,k  ) + tau13_arr(i+1,j,k)
-//                                       + tau13_arr(i,j,k+1) + tau13_arr(i+1,j,k+1) );
-            fab_arr(i, j, k, 3) = tau22_arr(i,j,k);
-//          fab_arr(i, j, k, 4) = 0.25 * ( tau23_arr(i,j,k  ) + tau23_arr(i,j+1,k)
-//                                       + tau23_arr(i,j,k+1) + tau23_arr(i,j+1,k+1) );
-            fab_arr(i, j, k, 5) = tau33_arr(i,j,k);
-//          fab_arr(i, j, k, 6) =  hfx3_arr(i,j,k);
-//          fab_arr(i, j, k, 7) =  (l_use_moist) ? q1fx3_arr(i,j,k) : 0.0;
-//          fab_arr(i, j, k, 8) =  (l_use_moist) ? q2fx3_arr(i,j,k) : 0.0;
-            fab_arr(i, j, k, 9) =  diss_arr(i,j,k);
+            f[0] = tau11_arr(i,j,k);
+            f[1] = 0.25 * ( tau12_arr(i,j  ,k) + tau12_arr(i+1,j  ,k)
+                          + tau12_arr(i,j+1,k) + tau12_arr(i+1,j+1,k) );
+            f[2] = tau22_arr(i,j,k);
+            f[3] = tau33_arr(i,j,k);
+            f[4] = diss_arr(i,j,k);
         });
 
-        const Box& zbx = mfi.tilebox(IntVect(0,0,1));
-        ParallelFor(zbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+        // A z face shared by two vertically stacked grids is counted by the upper grid only
+        Box zbx = mfi.tilebox(IntVect(0,0,1));
+        if (zbx.bigEnd(2) == mfi.validbox().bigEnd(2)+1 && zbx.bigEnd(2) < stag_domain.bigEnd(2)) {
+            zbx.growHi(2,-1);
+        }
+
+        havg_stag.add(zbx, [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuArray<Real,nprof>& f) noexcept
         {
             // average from edge to face center
-            fab_arr_stag(i,j,k,0) = 0.5*(tau13_arr(i,j,k) + tau13_arr(i+1,j  ,k));
-            fab_arr_stag(i,j,k,1) = 0.5*(tau23_arr(i,j,k) + tau23_arr(i  ,j+1,k));
+            f[0] = 0.5*(tau13_arr(i,j,k) + tau13_arr(i+1,j  ,k));
+            f[1] = 0.5*(tau23_arr(i,j,k) + tau23_arr(i  ,j+1,k));
 
-            fab_arr_stag(i,j,k,2) =  hfx3_arr(i,j,k);
-            fab_arr_stag(i,j,k,3) =  (l_use_moist) ? q1fx3_arr(i,j,k) : 0.0;
-            fab_arr_stag(i,j,k,4) =  (l_use_moist) ? q2fx3_arr(i,j,k) : 0.0;
+            f[2] = hfx3_arr(i,j,k);
+            f[3] = (l_use_moist) ? q1fx3_arr(i,j,k) : 0.0;
+            f[4] = (l_use_moist) ? q2fx3_arr(i,j,k) : 0.0;
         });
     }
 
-    int zdir = 2;
-    auto domain = geom[0].Domain();
-    Box stag_domain = domain;
-    stag_domain.convert(IntVect(0,0,1));
-
-    h_avg_tau11 = sumToLine(mf_out,0,1,domain,zdir);
-    h_avg_tau12 = sumToLine(mf_out,1,1,domain,zdir);
-//  h_avg_tau13 = sumToLine(mf_out,2,1,domain,zdir);
-    h_avg_tau22 = sumToLine(mf_out,3,1,domain,zdir);
-//  h_avg_tau23 = sumToLine(mf_out,4,1,domain,zdir);
-    h_avg_tau33 = sumToLine(mf_out,5,1,domain,zdir);
-//  h_avg_hfx3  = sumToLine(mf_out,6,1,domain,zdir);
-//  h_avg_q1fx3 = sumToLine(mf_out,7,1,domain,zdir);
-//  h_avg_q2fx3 = sumToLine(mf_out,8,1,domain,zdir);
-    h_avg_diss  = sumToLine(mf_out,9,1,domain,zdir);
-
-    h_avg_tau13 = sumToLine(mf_out_stag,0,1,stag_domain,zdir);
-    h_avg_tau23 = sumToLine(mf_out_stag,1,1,stag_domain,zdir);
-    h_avg_hfx3  = sumToLine(mf_out_stag,2,1,stag_domain,zdir);
-    h_avg_q1fx3 = sumToLine(mf_out_stag,3,1,stag_domain,zdir);
-    h_avg_q2fx3 = sumToLine(mf_out_stag,4,1,stag_domain,zdir);
-
-    int ht_size =  h_avg_tau11.size(); // _un_staggered
-
-    // Divide by the total number of cells we are averaging over
-    Real area_z = static_cast<Real>(domain.length(0)*domain.length(1));
-    for (int k = 0; k < ht_size; ++k) {
-        h_avg_tau11[k] /= area_z; h_avg_tau12[k] /= area_z;
-        h_avg_tau22[k] /= area_z;
-        h_avg_tau33[k] /= area_z;
-        h_avg_diss[k] /= area_z;
-    }
-    for (int k = 0; k < ht_size+1; ++k) { // staggered heights
-        h_avg_tau13[k] /= area_z;
-        h_avg_tau23[k] /= area_z;
-        h_avg_hfx3[k] /= area_z;
-        h_avg_q1fx3[k] /= area_z; h_avg_q2fx3[k] /= area_z;
-    }
+    havg.reduce();
+    havg_stag.reduce();
+
+    havg.line(0, h_avg_tau11); havg.line(1, h_avg_tau12);
+    havg.line(2, h_avg_tau22); havg.line(3, h_avg_tau33);
+    havg.line(4, h_avg_diss );
+
+    havg_stag.line(0, h_avg_tau13); havg_stag.line(1, h_avg_tau23);
+    havg_stag.line(2, h_avg_hfx3 ); havg_stag.line(3, h_avg_q1fx3); havg_stag.line(4, h_avg_q2fx3);
 }
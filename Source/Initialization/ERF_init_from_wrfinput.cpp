@@ -2,6 +2,8 @@
  * \file ERF_init_from_wrfinput.cpp
  */
 
+#include <limits>
+
 #include <ERF.H>
 #include <ERF_EOS.H>
 #include <ERF_Constants.H>
@@ -37,7 +39,9 @@ read_from_wrfinput (int lev, const Box& domain, const std::string& fname,
                     MoistureType moisture_type,
                     Real& Latitude,
                     Real& Longitude,
-                    Geometry& geom);
+                    Geometry& geom,
+                    bool read_distributed,
+                    const Vector<Box>& read_boxes);
 
 Real
 read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
@@ -45,7 +49,8 @@ read_from_wrfbdy (const std::string& nc_bdy_file, const Box& domain,
                   Vector<Vector<FArrayBox>>& bdy_data_xhi,
                   Vector<Vector<FArrayBox>>& bdy_data_ylo,
                   Vector<Vector<FArrayBox>>& bdy_data_yhi,
-                  int& width, Real& start_bdy_time);
+                  int& width, Real& start_bdy_time,
+                  int itime_lo, int itime_hi);
 
 void
 convert_wrfbdy_data (const Box& domain,
@@ -56,7 +61,9 @@ convert_wrfbdy_data (const Box& domain,
                      const FArrayBox& NC_xvel_fab,
                      const FArrayBox& NC_yvel_fab,
                      const FArrayBox& NC_theta_fab,
-                     const FArrayBox& NC_QVAPOR_fab);
+                     const FArrayBox& NC_QVAPOR_fab,
+                     bool read_distributed,
+                     int itime_lo, int itime_hi);
 
 void
 init_state_from_wrfinput (int lev,
@@ -83,7 +90,7 @@ init_msfs_from_wrfinput (int lev, FArrayBox& msfu_fab,
                          const Vector<FArrayBox>& NC_MSFM_fab);
 
 void
-verify_terrain_top_boundary (const Real& z_top,
+verify_terrain_top_boundary (const Real& z_top, const Vector<Box>& domains,
                              const Vector<FArrayBox>& NC_PH_fab,
                              const Vector<FArrayBox>& NC_PHB_fab);
 
@@ -148,6 +155,32 @@ ERF::init_from_wrfinput (int lev)
         amrex::Error("NetCDF initialization file name must be provided via input");
     }
 
+    auto& lev_new = vars_new[lev];
+
+    //
+    // With a distributed read every rank only reads the parts of the 3D fields that cover
+    // its own grids, one window per grid, each grown far enough for the ghost cells of the
+    // state, base state and terrain, plus one more cell for the stencils that average to
+    // nodes.  This is only done when there is a single file at this level.
+    //
+    bool read_distributed = nc_distributed_read;
+    if (read_distributed && num_boxes_at_level[lev] > 1) {
+        Warning("erf.nc_distributed_read is ignored when there are multiple wrfinput files at a level");
+        read_distributed = false;
+    }
+
+    Vector<Box> read_boxes;
+    if (read_distributed) {
+        IntVect ng_read = amrex::max(lev_new[Vars::cons].nGrowVect(), base_state[lev].nGrowVect());
+        if (solverChoice.use_terrain) {
+            ng_read = amrex::max(ng_read, z_phys_nd[lev]->nGrowVect());
+        }
+        ng_read += IntVect(1);
+        for (MFIter mfi(lev_new[Vars::cons], false); mfi.isValid(); ++mfi) {
+            read_boxes.push_back(grow(mfi.validbox(), ng_read));
+        }
+    }
+
     for (int idx = 0; idx < num_boxes_at_level[lev]; idx++)
     {
         read_from_wrfinput(lev, boxes_at_level[lev][idx], nc_init_file[lev][idx],
@@ -160,10 +193,10 @@ ERF::init_from_wrfinput (int lev)
                            NC_PH_fab[idx]    , NC_P_fab[idx]      , NC_PHB_fab[idx]  ,
                            NC_ALB_fab[idx]   , NC_PB_fab[idx]     ,
                            NC_LAT_fab[idx]   , NC_LON_fab[idx]    ,
-                           solverChoice.moisture_type, Latitude, Longitude, geom[lev]);
+                           solverChoice.moisture_type, Latitude, Longitude, geom[lev],
+                           read_distributed, read_boxes);
     }
 
-    auto& lev_new = vars_new[lev];
     int n_qstate = micro->Get_Qstate_Size();
 #ifdef _OPENMP
 #pragma omp parallel if (amrex::Gpu::notInLaunchRegion())
@@ -253,9 +286,7 @@ ERF::init_from_wrfinput (int lev)
     const Real& z_top = geom[lev].ProbHi(2);
     if (solverChoice.use_terrain)
     {
-        if (ParallelDescriptor::IOProcessor()) {
-            verify_terrain_top_boundary(z_top, NC_PH_fab, NC_PHB_fab);
-        }
+        verify_terrain_top_boundary(z_top, boxes_at_level[lev], NC_PH_fab, NC_PHB_fab);
 
         std::unique_ptr<MultiFab>& z_phys = z_phys_nd[lev];
         for ( MFIter mfi(lev_new[Vars::cons], TilingIfNotGPU()); mfi.isValid(); ++mfi )
@@ -301,9 +332,13 @@ ERF::init_from_wrfinput (int lev)
         if (nc_bdy_file.empty()) {
             amrex::Error("NetCDF boundary file name must be provided via input");
         }
+        // Without nc_bdy_lazy we read every snapshot now, otherwise only the first ones
+        int itime_hi = (nc_bdy_lazy) ? 1 + nc_bdy_lookahead : -1;
         bdy_time_interval = read_from_wrfbdy(nc_bdy_file,geom[0].Domain(),
                                              bdy_data_xlo,bdy_data_xhi,bdy_data_ylo,bdy_data_yhi,
-                                             real_width, start_bdy_time);
+                                             real_width, start_bdy_time, 0, itime_hi);
+        const int ntimes = bdy_data_xlo.size();
+        itime_hi = (itime_hi < 0) ? ntimes-1 : std::min(itime_hi, ntimes-1);
 
         Print() << "Read in boundary data with width "  << real_width << std::endl;
         Print() << "Running with specification width: " << real_set_width
@@ -311,16 +346,35 @@ ERF::init_from_wrfinput (int lev)
 
         convert_wrfbdy_data(domain,bdy_data_xlo,
                             NC_MUB_fab[0] , NC_C1H_fab[0] , NC_C2H_fab[0],
-                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0]);
+                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0],
+                            read_distributed, 0, itime_hi);
         convert_wrfbdy_data(domain,bdy_data_xhi,
                             NC_MUB_fab[0] , NC_C1H_fab[0] , NC_C2H_fab[0],
-                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0]);
+                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0],
+                            read_distributed, 0, itime_hi);
         convert_wrfbdy_data(domain,bdy_data_ylo,
                             NC_MUB_fab[0] , NC_C1H_fab[0] , NC_C2H_fab[0],
-                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0]);
+                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0],
+                            read_distributed, 0, itime_hi);
         convert_wrfbdy_data(domain,bdy_data_yhi,
                             NC_MUB_fab[0] , NC_C1H_fab[0] , NC_C2H_fab[0] ,
-                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0]);
+                            NC_xvel_fab[0], NC_yvel_fab[0], NC_theta_fab[0], NC_QVAPOR_fab[0],
+                            read_distributed, 0, itime_hi);
+
+        // Keep what we need to convert the snapshots we read later
+        if (nc_bdy_lazy) {
+            Arena* Arena_Used = The_Arena();
+#ifdef AMREX_USE_GPU
+            // These are written to checkpoints from the host
+            Arena_Used = The_Pinned_Arena();
+#endif
+            wrfbdy_MUB_fab.resize(NC_MUB_fab[0].box(),1,Arena_Used);
+            wrfbdy_C1H_fab.resize(NC_C1H_fab[0].box(),1,Arena_Used);
+            wrfbdy_C2H_fab.resize(NC_C2H_fab[0].box(),1,Arena_Used);
+            wrfbdy_MUB_fab.template copy<RunOn::Device>(NC_MUB_fab[0]);
+            wrfbdy_C1H_fab.template copy<RunOn::Device>(NC_C1H_fab[0]);
+            wrfbdy_C2H_fab.template copy<RunOn::Device>(NC_C2H_fab[0]);
+        }
     }
 
     // Start at the earliest time (read_from_wrfbdy)
@@ -328,6 +382,64 @@ ERF::init_from_wrfinput (int lev)
     t_old[lev] = start_bdy_time - 1.e200;
 }
 
+/**
+ * With erf.nc_bdy_lazy we only hold the wrfbdy snapshots bracketing the current time.
+ * This frees the snapshots that are no longer needed and reads (and converts) the ones
+ * needed to advance from time to time+dt, plus nc_bdy_lookahead more.
+ *
+ * @param time Time at the start of the step
+ * @param dt Time step at level 0
+ */
+void
+ERF::update_wrfbdy_window (Real time, Real dt)
+{
+    if (!nc_bdy_lazy || init_type != InitType::Real || bdy_data_xlo.empty()) return;
+
+    BL_PROFILE("ERF::update_wrfbdy_window()");
+
+    const int ntimes = bdy_data_xlo.size();
+
+    // The interpolation uses snapshots n_time and n_time+1 at every stage time
+    int n_lo = static_cast<int>( (time      - start_bdy_time) / bdy_time_interval );
+    int n_hi = static_cast<int>( (time + dt - start_bdy_time) / bdy_time_interval ) + 1 + nc_bdy_lookahead;
+    n_lo = std::max(0, std::min(n_lo, ntimes-1));
+    n_hi = std::max(n_lo, std::min(n_hi, ntimes-1));
+
+    // Free the snapshots we are done with
+    for (int nt = 0; nt < n_lo; ++nt) {
+        bdy_data_xlo[nt].clear();
+        bdy_data_xhi[nt].clear();
+        bdy_data_ylo[nt].clear();
+        bdy_data_yhi[nt].clear();
+    }
+
+    // Read the missing ones; these are always at the end of the window
+    int nt_read = n_lo;
+    while (nt_read <= n_hi && !bdy_data_xlo[nt_read].empty()) { ++nt_read; }
+    if (nt_read > n_hi) return;
+
+    // Snapshot 0 is built from wrfinput and can not be read again
+    AMREX_ALWAYS_ASSERT(nt_read > 0);
+
+    Real start_time = start_bdy_time;
+    read_from_wrfbdy(nc_bdy_file,geom[0].Domain(),
+                     bdy_data_xlo,bdy_data_xhi,bdy_data_ylo,bdy_data_yhi,
+                     real_width, start_time, nt_read, n_hi);
+
+    const Box& domain = geom[0].Domain();
+    FArrayBox dummy;
+    for (auto* bdy_data : {&bdy_data_xlo, &bdy_data_xhi, &bdy_data_ylo, &bdy_data_yhi}) {
+        convert_wrfbdy_data(domain, *bdy_data,
+                            wrfbdy_MUB_fab, wrfbdy_C1H_fab, wrfbdy_C2H_fab,
+                            dummy, dummy, dummy, dummy, false, nt_read, n_hi);
+    }
+
+    if (verbose > 0) {
+        Print() << "Read wrfbdy snapshots " << nt_read << " to " << n_hi
+                << "; holding " << n_lo << " to " << n_hi << " of " << ntimes << std::endl;
+    }
+}
+
 /**
  * Helper function to initialize state and velocity data in a Fab from a WRF dataset.
  *
@@ -364,7 +476,8 @@ init_state_from_wrfinput (int /*lev*/,
     {
         //
         // FArrayBox to FArrayBox copy does "copy on intersection"
-        // This only works here because we have broadcast the FArrayBox of data from the netcdf file to all ranks
+        // This only works here because the FArrayBox of data from the netcdf file covers
+        // this rank's grids, either broadcast to all ranks or read in parallel
         //
         // This copies x-vel
         x_vel_fab.template copy<RunOn::Device>(NC_xvel_fab[idx]);
@@ -425,7 +538,8 @@ init_msfs_from_wrfinput (int /*lev*/, FArrayBox& msfu_fab,
     {
         //
         // FArrayBox to FArrayBox copy does "copy on intersection"
-        // This only works here because we have broadcast the FArrayBox of data from the netcdf file to all ranks
+        // This only works here because the FArrayBox of data from the netcdf file covers
+        // this rank's grids, either broadcast to all ranks or read in parallel
         //
         // This copies mapfac_u
         msfu_fab.template copy<RunOn::Device>(NC_MSFU_fab[idx]);
@@ -473,7 +587,8 @@ init_base_state_from_wrfinput (int /*lev*/,
     {
         //
         // FArrayBox to FArrayBox copy does "copy on intersection"
-        // This only works here because we have broadcast the FArrayBox of data from the netcdf file to all ranks
+        // This only works here because the FArrayBox of data from the netcdf file covers
+        // this rank's grids, either broadcast to all ranks or read in parallel
         //
         const Array4<Real      >&   cons_arr = cons_fab.array();
         const Array4<Real      >&  p_hse_arr = p_hse.array();
@@ -519,57 +634,78 @@ init_base_state_from_wrfinput (int /*lev*/,
  * Helper function for verifying the top boundary is valid.
  *
  * @param z_top Real user specified top boundary
+ * @param domains Vector of Box objects specifying the region covered by each file
  * @param NC_PH_fab Vector of FArrayBox objects storing WRF terrain coordinate data (PH)
  * @param NC_PHB_fab Vector of FArrayBox objects storing WRF terrain coordinate data (PHB)
  */
 void
-verify_terrain_top_boundary (const Real& z_top,
+verify_terrain_top_boundary (const Real& z_top, const Vector<Box>& domains,
                              const Vector<FArrayBox>& NC_PH_fab,
                              const Vector<FArrayBox>& NC_PHB_fab)
 {
     int nboxes = NC_PH_fab.size();
     for (int idx = 0; idx < nboxes; idx++) {
         Gpu::HostVector  <Real> MaxMax_h(2,-1.0e16);
-        Gpu::DeviceVector<Real> MaxMax_d(2);
-        Gpu::copy(Gpu::hostToDevice, MaxMax_h.begin(), MaxMax_h.end(), MaxMax_d.begin());
-
-        Real* mm_d = MaxMax_d.data();
-
-        Box Fab2dBox_hi (NC_PHB_fab[idx].box()); Fab2dBox_hi.makeSlab(2,Fab2dBox_hi.bigEnd(2));
-        Box Fab2dBox_lo (NC_PHB_fab[idx].box()); Fab2dBox_lo.makeSlab(2,Fab2dBox_lo.bigEnd(2)-1);
-
-        Box nodal_box = amrex::surroundingNodes(NC_PHB_fab[idx].box());
-        int ilo = nodal_box.smallEnd()[0];
-        int ihi = nodal_box.bigEnd()[0];
-        int jlo = nodal_box.smallEnd()[1];
-        int jhi = nodal_box.bigEnd()[1];
-
-        auto const& phb = NC_PHB_fab[idx].const_array();
-        auto const& ph  = NC_PH_fab[idx].const_array();
+        if (NC_PHB_fab[idx].box().ok()) {
+            Gpu::DeviceVector<Real> MaxMax_d(2);
+            Gpu::copy(Gpu::hostToDevice, MaxMax_h.begin(), MaxMax_h.end(), MaxMax_d.begin());
+
+            Real* mm_d = MaxMax_d.data();
+
+            // The fab may only hold part of the file; clamp to the file and skip the
+            // points whose low neighbors are not held here (another rank covers them)
+            const Box& domain = domains[idx];
+            Box fab_box(NC_PHB_fab[idx].box());
+            if (fab_box.smallEnd(0) > domain.smallEnd(0)) fab_box.growLo(0,-1);
+            if (fab_box.smallEnd(1) > domain.smallEnd(1)) fab_box.growLo(1,-1);
+
+            Box Fab2dBox_hi (fab_box); Fab2dBox_hi.makeSlab(2,Fab2dBox_hi.bigEnd(2));
+            Box Fab2dBox_lo (fab_box); Fab2dBox_lo.makeSlab(2,Fab2dBox_lo.bigEnd(2)-1);
+
+            Box nodal_box = amrex::surroundingNodes(domain);
+            int ilo = nodal_box.smallEnd()[0];
+            int ihi = nodal_box.bigEnd()[0];
+            int jlo = nodal_box.smallEnd()[1];
+            int jhi = nodal_box.bigEnd()[1];
+
+            auto const& phb = NC_PHB_fab[idx].const_array();
+            auto const& ph  = NC_PH_fab[idx].const_array();
+
+            // Points between the windows of a distributed read hold the lowest Real
+            const Real no_data = std::numeric_limits<Real>::lowest();
+
+            ParallelFor(Fab2dBox_hi, Fab2dBox_lo,
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            {
+                int ii = std::max(std::min(i,ihi-1),ilo+1);
+                int jj = std::max(std::min(j,jhi-1),jlo+1);
+                if (phb(ii,jj  ,k) == no_data || phb(ii-1,jj  ,k) == no_data ||
+                    phb(ii,jj-1,k) == no_data || phb(ii-1,jj-1,k) == no_data) return;
+                Real z_calc = 0.25 * ( ph (ii,jj  ,k) + ph (ii-1,jj  ,k) +
+                                       ph (ii,jj-1,k) + ph (ii-1,jj-1,k) +
+                                       phb(ii,jj  ,k) + phb(ii-1,jj  ,k) +
+                                       phb(ii,jj-1,k) + phb(ii-1,jj-1,k) ) / CONST_GRAV;
+                amrex::Gpu::Atomic::Max(&(mm_d[0]),z_calc);
+            },
+            [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            {
+                int ii = std::max(std::min(i,ihi-1),ilo+1);
+                int jj = std::max(std::min(j,jhi-1),jlo+1);
+                if (phb(ii,jj  ,k) == no_data || phb(ii-1,jj  ,k) == no_data ||
+                    phb(ii,jj-1,k) == no_data || phb(ii-1,jj-1,k) == no_data) return;
+                Real z_calc = 0.25 * ( ph (ii,jj  ,k) + ph (ii-1,jj  ,k) +
+                                       ph (ii,jj-1,k) + ph (ii-1,jj-1,k) +
+                                       phb(ii,jj  ,k) + phb(ii-1,jj  ,k) +
+                                       phb(ii,jj-1,k) + phb(ii-1,jj-1,k) ) / CONST_GRAV;
+                amrex::Gpu::Atomic::Max(&(mm_d[1]),z_calc);
+            });
+
+            Gpu::copy(Gpu::deviceToHost, MaxMax_d.begin(), MaxMax_d.end(), MaxMax_h.begin());
+        }
 
-        ParallelFor(Fab2dBox_hi, Fab2dBox_lo,
-        [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-        {
-            int ii = std::max(std::min(i,ihi-1),ilo+1);
-            int jj = std::max(std::min(j,jhi-1),jlo+1);
-            Real z_calc = 0.25 * ( ph (ii,jj  ,k) + ph (ii-1,jj  ,k) +
-                                   ph (ii,jj-1,k) + ph (ii-1,jj-1,k) +
-                                   phb(ii,jj  ,k) + phb(ii-1,jj  ,k) +
-                                   phb(ii,jj-1,k) + phb(ii-1,jj-1,k) ) / CONST_GRAV;
-            amrex::Gpu::Atomic::Max(&(mm_d[0]),z_calc);
-        },
-        [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
-        {
-            int ii = std::max(std::min(i,ihi-1),ilo+1);
-            int jj = std::max(std::min(j,jhi-1),jlo+1);
-            Real z_calc = 0.25 * ( ph (ii,jj  ,k) + ph (ii-1,jj  ,k) +
-                                   ph (ii,jj-1,k) + ph (ii-1,jj-1,k) +
-                                   phb(ii,jj  ,k) + phb(ii-1,jj  ,k) +
-                                   phb(ii,jj-1,k) + phb(ii-1,jj-1,k) ) / CONST_GRAV;
-            amrex::Gpu::Atomic::Max(&(mm_d[1]),z_calc);
-        });
+        // The PH/PHB data may be distributed across ranks
+        ParallelDescriptor::ReduceRealMax(MaxMax_h.data(), 2);
 
-        Gpu::copy(Gpu::deviceToHost, MaxMax_d.begin(), MaxMax_d.end(), MaxMax_h.begin());
         if ((z_top > MaxMax_h[0]) || (z_top < MaxMax_h[1])) {
             Print() << "Z problem extent " << z_top << " does not match NETCDF file min "
                     << MaxMax_h[1] << " and max " << MaxMax_h[0] << "!\n";
@@ -1,5 +1,6 @@
 #include <ERF_EOS.H>
 #include <ERF_TileNoZ.H>
+#include <ERF_ColumnPack.H>
 #include "ERF_Kessler.H"
 #include "ERF_DataStruct.H"
 
@@ -17,22 +18,28 @@ void Kessler::AdvanceKessler (const SolverChoice &solverChoice)
         int k_lo = domain.smallEnd(2);
         int k_hi = domain.bigEnd(2);
 
-        MultiFab fz;
-        auto ba    = tabs->boxArray();
-        auto dm    = tabs->DistributionMap();
-        fz.define(convert(ba, IntVect(0,0,1)), dm, 1, 0); // No ghost cells
-
         Real dtn = dt;
 
-        for ( MFIter mfi(fz, TilingIfNotGPU()); mfi.isValid(); ++mfi ){
-            auto rho_array = mic_fab_vars[MicVar_Kess::rho]->array(mfi);
-            auto qp_array  = mic_fab_vars[MicVar_Kess::qp]->array(mfi);
+        for ( MFIter mfi(*tabs, TileNoZ()); mfi.isValid(); ++mfi) {
+            auto qv_array    = mic_fab_vars[MicVar_Kess::qv]->array(mfi);
+            auto qc_array    = mic_fab_vars[MicVar_Kess::qcl]->array(mfi);
+            auto qp_array    = mic_fab_vars[MicVar_Kess::qp]->array(mfi);
+            auto qt_array    = mic_fab_vars[MicVar_Kess::qt]->array(mfi);
+            auto tabs_array  = mic_fab_vars[MicVar_Kess::tabs]->array(mfi);
+            auto pres_array  = mic_fab_vars[MicVar_Kess::pres]->array(mfi);
+            auto theta_array = mic_fab_vars[MicVar_Kess::theta]->array(mfi);
+            auto rho_array   = mic_fab_vars[MicVar_Kess::rho]->array(mfi);
             auto rain_accum_array = mic_fab_vars[MicVar_Kess::rain_accum]->array(mfi);
 
-            auto fz_array  = fz.array(mfi);
-            const Box& tbz = mfi.tilebox();
+            const auto dJ_array = (m_detJ_cc) ? m_detJ_cc->const_array(mfi) : Array4<const Real>{};
+
+            const auto& box3d = mfi.tilebox();
 
-            ParallelFor(tbz, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
+            // Sedimentation flux on the z-faces of this tile, stored as one contiguous column per (i,j)
+            ColumnPack fz(surroundingNodes(box3d,2), 1);
+            const ColumnArray fz_array = fz.array(0);
+
+            ParallelFor(fz.box(), [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept
             {
                 Real rho_avg, qp_avg;
 
@@ -63,27 +70,8 @@ void Kessler::AdvanceKessler (const SolverChoice &solverChoice)
                     rain_accum_array(i,j,k) = rain_accum_array(i,j,k) + rho_avg*qp_avg*V_terminal*dtn/1000.0*1000.0; // Divide by rho_water and convert to mm
                 }
 
-                /*if(k==0){
-                  fz_array(i,j,k) = 0;
-                  }*/
+                if(std::fabs(fz_array(i,j,k)) < 1e-14) fz_array(i,j,k) = 0.0;
             });
-        }
-
-        for ( MFIter mfi(*tabs,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
-            auto qv_array    = mic_fab_vars[MicVar_Kess::qv]->array(mfi);
-            auto qc_array    = mic_fab_vars[MicVar_Kess::qcl]->array(mfi);
-            auto qp_array    = mic_fab_vars[MicVar_Kess::qp]->array(mfi);
-            auto qt_array    = mic_fab_vars[MicVar_Kess::qt]->array(mfi);
-            auto tabs_array  = mic_fab_vars[MicVar_Kess::tabs]->array(mfi);
-            auto pres_array  = mic_fab_vars[MicVar_Kess::pres]->array(mfi);
-            auto theta_array = mic_fab_vars[MicVar_Kess::theta]->array(mfi);
-            auto rho_array   = mic_fab_vars[MicVar_Kess::rho]->array(mfi);
-
-            const auto dJ_array = (m_detJ_cc) ? m_detJ_cc->const_array(mfi) : Array4<const Real>{};
-
-            const auto& box3d = mfi.tilebox();
-
-            auto fz_array  = fz.array(mfi);
 
             // Expose for GPU
             Real d_fac_cond = m_fac_cond;
@@ -163,8 +151,6 @@ void Kessler::AdvanceKessler (const SolverChoice &solverChoice)
                     dq_clwater_to_rain = std::min(dq_clwater_to_rain, qc_array(i,j,k));
                 }
 
-                if(std::fabs(fz_array(i,j,k+1)) < 1e-14) fz_array(i,j,k+1) = 0.0;
-                if(std::fabs(fz_array(i,j,k  )) < 1e-14) fz_array(i,j,k  ) = 0.0;
                 Real dq_sed = dtn * dJinv * (1.0/rho_array(i,j,k)) * (fz_array(i,j,k+1) - fz_array(i,j,k))/dz;
                 if(std::fabs(dq_sed) < 1e-14) dq_sed = 0.0;
 
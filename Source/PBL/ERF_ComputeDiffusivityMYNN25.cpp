@@ -4,6 +4,7 @@
 #include "ERF_Constants.H"
 #include "ERF_TurbStruct.H"
 #include "ERF_PBLModels.H"
+#include "ERF_ColumnPack.H"
 
 using namespace amrex;
 
@@ -65,40 +66,53 @@ ComputeDiffusivityMYNN25 (const MultiFab& xvel,
 
         const Box xybx = PerpendicularBox<ZDir>(bx, IntVect{0,0,0});
         FArrayBox qintegral(xybx,2);
-        qintegral.setVal<RunOn::Device>(0.0);
-        FArrayBox qturb(bx,1); FArrayBox qturb_old(bx,1);
         const Array4<Real> qint = qintegral.array();
-        const Array4<Real> qvel = qturb.array();
 
-        // vertical integrals to compute lengthscale
+        // Pack q, the height above the surface and (with terrain) the cell thickness into contiguous
+        // columns so the vertical integrals are one sweep per column rather than an atomic add per cell
+        ColumnPack pack(bx, (use_terrain) ? 3 : 2);
+        pack.fill(0, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            return std::sqrt(cell_data(i,j,k,RhoQKE_comp) / cell_data(i,j,k,Rho_comp));
+        });
         if (use_terrain) {
             const Array4<Real const> &z_nd_arr = z_phys_nd->array(mfi);
             const auto invCellSize = geom.InvCellSizeArray();
-            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            pack.fill(1, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
-                qvel(i,j,k)     = std::sqrt(cell_data(i,j,k,RhoQKE_comp) / cell_data(i,j,k,Rho_comp));
-                AMREX_ASSERT_WITH_MESSAGE(qvel(i,j,k) > 0.0, "QKE must have a positive value");
-
-                Real fac = (sbx.contains(i,j,k)) ? 1.0 : 0.0;
-                const Real Zval = Compute_Zrel_AtCellCenter(i,j,k,z_nd_arr);
-                const Real dz = Compute_h_zeta_AtCellCenter(i,j,k,invCellSize,z_nd_arr);
-                Gpu::Atomic::Add(&qint(i,j,0,0), Zval*qvel(i,j,k)*dz*fac);
-                Gpu::Atomic::Add(&qint(i,j,0,1),      qvel(i,j,k)*dz*fac);
+                return Compute_Zrel_AtCellCenter(i,j,k,z_nd_arr);
+            });
+            pack.fill(2, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                return Compute_h_zeta_AtCellCenter(i,j,k,invCellSize,z_nd_arr);
             });
         } else {
-            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            pack.fill(1, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
-                qvel(i,j,k)     = std::sqrt(cell_data(i,j,k,RhoQKE_comp) / cell_data(i,j,k,Rho_comp));
-                AMREX_ASSERT_WITH_MESSAGE(qvel(i,j,k) > 0.0, "QKE must have a positive value");
-
-                // Not multiplying by dz: its constant and would fall out when we divide qint0/qint1 anyway
-
-                Real fac = (sbx.contains(i,j,k)) ? 1.0 : 0.0;
-                const Real Zval = gdata.ProbLo(2) + (k + 0.5)*gdata.CellSize(2);
-                Gpu::Atomic::Add(&qint(i,j,0,0), Zval*qvel(i,j,k)*fac);
-                Gpu::Atomic::Add(&qint(i,j,0,1),      qvel(i,j,k)*fac);
+                return gdata.ProbLo(2) + (k + 0.5)*gdata.CellSize(2);
             });
         }
+        const ColumnArray qvel   = pack.array(0);
+        const ColumnArray zcol   = pack.array(1);
+        const ColumnArray dz_col = (use_terrain) ? pack.array(2) : ColumnArray{};
+
+        // vertical integrals to compute lengthscale
+        // Without terrain we do not multiply by dz: it is constant and falls out when we divide qint0/qint1
+        const int ks_lo = sbx.smallEnd(2);
+        const int ks_hi = sbx.bigEnd(2);
+        ParallelFor(xybx, [=] AMREX_GPU_DEVICE (int i, int j, int) noexcept
+        {
+            Real qint0 = 0.0;
+            Real qint1 = 0.0;
+            for (int k = ks_lo; k <= ks_hi; ++k) {
+                AMREX_ASSERT_WITH_MESSAGE(qvel(i,j,k) > 0.0, "QKE must have a positive value");
+                const Real dz = (use_terrain) ? dz_col(i,j,k) : 1.0;
+                qint0 += zcol(i,j,k)*qvel(i,j,k)*dz;
+                qint1 +=             qvel(i,j,k)*dz;
+            }
+            qint(i,j,0,0) = qint0;
+            qint(i,j,0,1) = qint1;
+        });
 
         Real dz_inv = geom.InvCellSize(2);
         const auto& dxInv = geom.InvCellSizeArray();
@@ -165,8 +179,7 @@ ComputeDiffusivityMYNN25 (const MultiFab& xvel,
             // Surface-layer length scale (NN09, Eqn. 53)
             AMREX_ASSERT(l_obukhov != 0);
             int lk = amrex::max(k,0);
-            const Real zval = use_terrain ? Compute_Zrel_AtCellCenter(i,j,lk,z_nd_arr)
-                                          : gdata.ProbLo(2) + (lk + 0.5)*gdata.CellSize(2);
+            const Real zval = zcol(i,j,lk);
             const Real zeta = zval/l_obukhov;
             Real l_S;
             if (zeta >= 1.0) {
@@ -4,6 +4,7 @@
 #include "ERF_Constants.H"
 #include "ERF_TurbStruct.H"
 #include "ERF_PBLModels.H"
+#include "ERF_ColumnPack.H"
 
 using namespace amrex;
 
@@ -79,6 +80,27 @@ ComputeDiffusivityYSU (const MultiFab& xvel,
             const auto& pblh_arr = pbl_height.array();
             const auto& pbli_arr = pbl_index.array();
 
+            // Pack potential temperature, horizontal wind speed squared and height above the surface
+            // into contiguous columns; the PBL height search and the diffusivities below read them in k
+            ColumnPack pack(bx, 3);
+            pack.fill(0, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                return cell_data(i,j,k,RhoTheta_comp) / cell_data(i,j,k,Rho_comp);
+            });
+            pack.fill(1, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                return 0.25*( (uvel(i,j,k)+uvel(i+1,j  ,k))*(uvel(i,j,k)+uvel(i+1,j  ,k))
+                            + (vvel(i,j,k)+vvel(i  ,j+1,k))*(vvel(i,j,k)+vvel(i  ,j+1,k)) );
+            });
+            pack.fill(2, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                return use_terrain ? Compute_Zrel_AtCellCenter(i,j,k,z_nd_arr)
+                                   : gdata.ProbLo(2) + (k + 0.5)*gdata.CellSize(2);
+            });
+            const ColumnArray theta_col = pack.array(0);
+            const ColumnArray ws2_col   = pack.array(1);
+            const ColumnArray zrel_col  = pack.array(2);
+
             // -- Diagnose PBL height - starting out assuming non-moist --
             // loop is only over i,j in order to find height at each x,y
             const Real f0 = turbChoice.pbl_ysu_coriolis_freq;
@@ -117,13 +139,12 @@ ComputeDiffusivityYSU (const MultiFab& xvel,
                 bool above_critical = false;
                 int kpbl = 0;
                 Real Rib_up = Rib_layer, Rib_dn;
-                const Real base_theta = cell_data(i,j,0,RhoTheta_comp) / cell_data(i,j,0,Rho_comp);
+                const Real base_theta = theta_col(i,j,0);
                 while (!above_critical and bx.contains(i,j,kpbl+1)) {
                     kpbl += 1;
-                    const Real zval = use_terrain ? Compute_Zrel_AtCellCenter(i,j,kpbl,z_nd_arr) : gdata.ProbLo(2) + (kpbl + 0.5)*gdata.CellSize(2);
-                    const Real ws2_level = 0.25*( (uvel(i,j,kpbl)+uvel(i+1,j  ,kpbl))*(uvel(i,j,kpbl)+uvel(i+1,j  ,kpbl))
-                                                + (vvel(i,j,kpbl)+vvel(i  ,j+1,kpbl))*(vvel(i,j,kpbl)+vvel(i  ,j+1,kpbl)) );
-                    const Real theta = cell_data(i,j,kpbl,RhoTheta_comp) / cell_data(i,j,kpbl,Rho_comp);
+                    const Real zval = zrel_col(i,j,kpbl);
+                    const Real ws2_level = ws2_col(i,j,kpbl);
+                    const Real theta = theta_col(i,j,kpbl);
                     Rib_dn = Rib_up;
                     Rib_up = (theta-base_theta)/base_theta * CONST_GRAV * zval / ws2_level;
                     above_critical = Rib_up >= Rib_cr;
@@ -138,12 +159,12 @@ ComputeDiffusivityYSU (const MultiFab& xvel,
                     interp_fact = (Rib_cr - Rib_dn) / (Rib_up - Rib_dn);
                 }
 
-                const Real zval_up = use_terrain ? Compute_Zrel_AtCellCenter(i,j,kpbl,z_nd_arr) : gdata.ProbLo(2) + (kpbl + 0.5)*gdata.CellSize(2);
-                const Real zval_dn = use_terrain ? Compute_Zrel_AtCellCenter(i,j,kpbl-1,z_nd_arr) : gdata.ProbLo(2) + (kpbl-1 + 0.5)*gdata.CellSize(2);
+                const Real zval_up = zrel_col(i,j,kpbl);
+                const Real zval_dn = zrel_col(i,j,kpbl-1);
                 pblh_arr(i,j,0) = zval_dn + interp_fact*(zval_up-zval_dn);
 
-                const Real zval_0 = use_terrain ? Compute_Zrel_AtCellCenter(i,j,0,z_nd_arr) : gdata.ProbLo(2) + (0.5)*gdata.CellSize(2);
-                const Real zval_1 = use_terrain ? Compute_Zrel_AtCellCenter(i,j,1,z_nd_arr) : gdata.ProbLo(2) + (1.5)*gdata.CellSize(2);
+                const Real zval_0 = zrel_col(i,j,0);
+                const Real zval_1 = zrel_col(i,j,1);
                 if (pblh_arr(i,j,0) < 0.5*(zval_0+zval_1) ) {
                     kpbl = 0;
                 }
@@ -177,7 +198,7 @@ ComputeDiffusivityYSU (const MultiFab& xvel,
 
             ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
-                const Real zval = use_terrain ? Compute_Zrel_AtCellCenter(i,j,k,z_nd_arr) : gdata.ProbLo(2) + (k + 0.5)*gdata.CellSize(2);
+                const Real zval = zrel_col(i,j,k);
                 const Real rho = cell_data(i,j,k,Rho_comp);
                 const Real met_h_zeta = use_terrain ? Compute_h_zeta_AtCellCenter(i,j,k,dxInv,z_nd_arr) : 1.0;
                 const Real dz_terrain = met_h_zeta/dz_inv;
@@ -212,7 +233,7 @@ ComputeDiffusivityYSU (const MultiFab& xvel,
                                                   v_ext_dir_on_zlo, v_ext_dir_on_zhi,
                                                   dthetadz, dudz, dvdz, RhoQv_comp, RhoQr_comp);
                     const Real shear_squared = dudz*dudz + dvdz*dvdz + 1.0e-9; // 1.0e-9 from WRF to avoid divide by zero
-                    const Real theta = cell_data(i,j,k,RhoTheta_comp) / cell_data(i,j,k,Rho_comp);
+                    const Real theta = theta_col(i,j,k);
                     Real richardson = CONST_GRAV / theta * dthetadz / shear_squared;
                     const Real lambdadz = std::min(std::max(0.1*dz_terrain , lam0), 300.0); // in WRF, H10 paper just says use lam0
                     const Real lengthscale = lambdadz * KAPPA * zval / (lambdadz + KAPPA * zval);
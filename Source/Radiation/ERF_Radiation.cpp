@@ -49,6 +49,19 @@ namespace internal {
         fluxes.bnd_flux_dn_dir = real3d("flux_dn_dir", nz, nlay+1, nbands);
     }
 
+    void reset_fluxes (FluxesByband& fluxes)
+    {
+        yakl::memset(fluxes.flux_up    , 0.);
+        yakl::memset(fluxes.flux_dn    , 0.);
+        yakl::memset(fluxes.flux_net   , 0.);
+        yakl::memset(fluxes.flux_dn_dir, 0.);
+
+        yakl::memset(fluxes.bnd_flux_up    , 0.);
+        yakl::memset(fluxes.bnd_flux_dn    , 0.);
+        yakl::memset(fluxes.bnd_flux_net   , 0.);
+        yakl::memset(fluxes.bnd_flux_dn_dir, 0.);
+    }
+
     void expand_day_fluxes (const FluxesByband& daytime_fluxes,
                             FluxesByband& expanded_fluxes,
                             const int1d& day_indices)
@@ -137,88 +150,101 @@ void Radiation::initialize (const MultiFab& cons_in,
     m_lsm_fluxes = lsm_fluxes;
     m_lsm_zenith = lsm_zenith;
 
-    rrtmgp_data_path = getRadiationDataDir() + "/";
-    rrtmgp_coefficients_file_sw = rrtmgp_data_path + rrtmgp_coefficients_file_name_sw;
-    rrtmgp_coefficients_file_lw = rrtmgp_data_path + rrtmgp_coefficients_file_name_lw;
+    // The k-distributions and cloud optics tables are read from file only once
+    if (!m_tables_loaded) {
+        rrtmgp_data_path = getRadiationDataDir() + "/";
+        rrtmgp_coefficients_file_sw = rrtmgp_data_path + rrtmgp_coefficients_file_name_sw;
+        rrtmgp_coefficients_file_lw = rrtmgp_data_path + rrtmgp_coefficients_file_name_lw;
+
+        ParmParse pp("erf");
+        pp.query("fixed_total_solar_irradiance", fixed_total_solar_irradiance);
+        pp.query("radiation_uniform_angle"     , uniform_angle);
+        pp.query("moisture_model", moisture_type); // TODO: get from SolverChoice?
+        has_qmoist = (moisture_type != "None");
+
+        ngas = active_gases.size();
+
+        // initialize cloud, aerosol, and radiation
+        radiation.initialize(ngas, active_gases,
+                             rrtmgp_coefficients_file_sw.c_str(),
+                             rrtmgp_coefficients_file_lw.c_str());
+
+        // initialize the radiation data
+        nswbands = radiation.get_nband_sw();
+        nswgpts  = radiation.get_ngpt_sw();
+        nlwbands = radiation.get_nband_lw();
+        nlwgpts  = radiation.get_ngpt_lw();
+
+        rrtmg_to_rrtmgp = int1d("rrtmg_to_rrtmgp",14);
+        parallel_for(14, YAKL_LAMBDA (int i)
+        {
+            if (i == 1) {
+                rrtmg_to_rrtmgp(i) = 13;
+            } else {
+                rrtmg_to_rrtmgp(i) = i - 1;
+            }
+        });
 
-    ParmParse pp("erf");
-    pp.query("fixed_total_solar_irradiance", fixed_total_solar_irradiance);
-    pp.query("radiation_uniform_angle"     , uniform_angle);
-    pp.query("moisture_model", moisture_type); // TODO: get from SolverChoice?
-    has_qmoist = (moisture_type != "None");
+        m_tables_loaded = true;
+    }
 
     nlev = geom.Domain().length(2);
     ncol = 0;
     rank_offsets.resize(cons_in.local_size());
-    for (MFIter mfi(cons_in, TileNoZ()); mfi.isValid(); ++mfi) {
-        const auto& box3d = mfi.tilebox();
-        int nx = box3d.length(0);
-        int ny = box3d.length(1);
+    box_ncols.resize(cons_in.local_size());
+    for (MFIter mfi(cons_in); mfi.isValid(); ++mfi) {
         rank_offsets[mfi.LocalIndex()] = ncol;
-        ncol += nx * ny;
+        box_ncols[mfi.LocalIndex()] = RadColumnMap(mfi.validbox(), m_coarsen, 0).numColumns();
+        ncol += box_ncols[mfi.LocalIndex()];
     }
 
-    ngas = active_gases.size();
-
-    // initialize cloud, aerosol, and radiation
-    radiation.initialize(ngas, active_gases,
-                         rrtmgp_coefficients_file_sw.c_str(),
-                         rrtmgp_coefficients_file_lw.c_str());
-
-    // initialize the radiation data
-    nswbands = radiation.get_nband_sw();
-    nswgpts  = radiation.get_ngpt_sw();
-    nlwbands = radiation.get_nband_lw();
-    nlwgpts  = radiation.get_ngpt_lw();
-
-    rrtmg_to_rrtmgp = int1d("rrtmg_to_rrtmgp",14);
-    parallel_for(14, YAKL_LAMBDA (int i)
-    {
-        if (i == 1) {
-            rrtmg_to_rrtmgp(i) = 13;
-        } else {
-            rrtmg_to_rrtmgp(i) = i - 1;
-        }
-    });
-
-    tmid = real2d("tmid", ncol, nlev);
-    pmid = real2d("pmid", ncol, nlev);
-    pdel = real2d("pdel", ncol, nlev);
-
-    pint = real2d("pint", ncol, nlev+1);
-    tint = real2d("tint", ncol, nlev+1);
-
-    qt   = real2d("qt", ncol, nlev);
-    qc   = real2d("qc", ncol, nlev);
-    qi   = real2d("qi", ncol, nlev);
-    qn   = real2d("qn", ncol, nlev);
-    zi   = real2d("zi", ncol, nlev);
+    // The workspace only depends on the number of columns and levels,
+    // so it survives across calls until the grids change size
+    if (ncol != m_ws_ncol || nlev != m_ws_nlev) {
+        alloc_workspace();
+    }
 
-    // Get the temperature, density, theta, qt and qp from input
-    for (MFIter mfi(cons_in, TileNoZ()); mfi.isValid(); ++mfi) {
-        const auto& box3d = mfi.tilebox();
-        auto nx = box3d.length(0);
+    // Get the temperature, density, theta, qt and qp from input; with coarsening
+    // each column holds the horizontal mean over its block of cells
+    for (MFIter mfi(cons_in); mfi.isValid(); ++mfi) {
+        const auto& box3d = mfi.validbox();
+        const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
 
         auto states_array = cons_in.array(mfi);
         auto qt_array = (has_qmoist) ? qmoist[0]->array(mfi) : Array4<Real> {};
         auto qv_array = (has_qmoist) ? qmoist[1]->array(mfi) : Array4<Real> {};
         auto qc_array = (has_qmoist) ? qmoist[2]->array(mfi) : Array4<Real> {};
         auto qi_array = (has_qmoist && qmoist.size()>=8) ? qmoist[3]->array(mfi) : Array4<Real> {};
-        const int offset = rank_offsets[mfi.LocalIndex()];
 
         // Get pressure, theta, temperature, density, and qt, qp
-        ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
+        ParallelFor(cmap.columns(box3d.smallEnd(2), box3d.bigEnd(2)),
+        [=] AMREX_GPU_DEVICE (int ic, int jc, int k)
         {
-            auto icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+            int i0, i1, j0, j1;
+            cmap.cells(ic, jc, i0, i1, j0, j1);
+
+            Real qt_sum(0.0), qc_sum(0.0), qi_sum(0.0), t_sum(0.0), p_sum(0.0);
+            for (int j = j0; j <= j1; ++j) {
+                for (int i = i0; i <= i1; ++i) {
+                    Real qv = (qv_array) ? qv_array(i,j,k): 0.0;
+                    qt_sum += (qt_array) ? qt_array(i,j,k): 0.0;
+                    qc_sum += (qc_array) ? qc_array(i,j,k): 0.0;
+                    qi_sum += (qi_array) ? qi_array(i,j,k): 0.0;
+                    t_sum  += getTgivenRandRTh(states_array(i,j,k,Rho_comp),states_array(i,j,k,RhoTheta_comp),qv);
+                    // NOTE: RRTMGP code expects pressure in pa
+                    p_sum  += getPgivenRTh(states_array(i,j,k,RhoTheta_comp),qv);
+                }
+            }
+            const Real inv_n = 1.0 / Real((i1-i0+1)*(j1-j0+1));
+
+            auto icol = cmap.column(ic,jc);
             auto ilev = k+1;
-            Real qv         = (qv_array) ? qv_array(i,j,k): 0.0;
-            qt(icol,ilev)   = (qt_array) ? qt_array(i,j,k): 0.0;
-            qc(icol,ilev)   = (qc_array) ? qc_array(i,j,k): 0.0;
-            qi(icol,ilev)   = (qi_array) ? qi_array(i,j,k): 0.0;
+            qt(icol,ilev)   = qt_sum * inv_n;
+            qc(icol,ilev)   = qc_sum * inv_n;
+            qi(icol,ilev)   = qi_sum * inv_n;
             qn(icol,ilev)   = qc(icol,ilev) + qi(icol,ilev);
-            tmid(icol,ilev) = getTgivenRandRTh(states_array(i,j,k,Rho_comp),states_array(i,j,k,RhoTheta_comp),qv);
-            // NOTE: RRTMGP code expects pressure in pa
-            pmid(icol,ilev) = getPgivenRTh(states_array(i,j,k,RhoTheta_comp),qv);
+            tmid(icol,ilev) = t_sum * inv_n;
+            pmid(icol,ilev) = p_sum * inv_n;
         });
     }
 
@@ -241,6 +267,25 @@ void Radiation::initialize (const MultiFab& cons_in,
         zi(icol, ilev)  = lowz + (ilev+0.5)*dz;
         pdel(icol,ilev) = pint(icol,ilev+1) - pint(icol,ilev);
     });
+}
+
+// allocate the per-column arrays used by initialize() and run()
+void Radiation::alloc_workspace ()
+{
+    BL_PROFILE("Radiation::alloc_workspace()");
+
+    tmid = real2d("tmid", ncol, nlev);
+    pmid = real2d("pmid", ncol, nlev);
+    pdel = real2d("pdel", ncol, nlev);
+
+    pint = real2d("pint", ncol, nlev+1);
+    tint = real2d("tint", ncol, nlev+1);
+
+    qt   = real2d("qt", ncol, nlev);
+    qc   = real2d("qc", ncol, nlev);
+    qi   = real2d("qi", ncol, nlev);
+    qn   = real2d("qn", ncol, nlev);
+    zi   = real2d("zi", ncol, nlev);
 
     albedo_dir = real2d("albedo_dir", nswbands, ncol);
     albedo_dif = real2d("albedo_dif", nswbands, ncol);
@@ -253,30 +298,6 @@ void Radiation::initialize (const MultiFab& cons_in,
     qrsc = real2d("qrsc", ncol, nlev);
     qrlc = real2d("qrlc", ncol, nlev);
 
-    int nmodes = 3;
-    int nrh = 1;
-    int top_lev = 1;
-    naer = 4;
-    std::vector<std::string> aero_names {"H2O", "N2", "O2", "O3"};
-    auto geom_radius = real2d("geom_radius", ncol, nlev);
-    yakl::memset(geom_radius, 0.1);
-
-    optics.initialize(ngas, nmodes, naer, nswbands, nlwbands,
-                      ncol, nlev, nrh, top_lev, aero_names, zi,
-                      pmid, pdel, tmid, qt, geom_radius);
-
-    amrex::Print() << "LW coefficients file: " << rrtmgp_coefficients_file_lw
-                   << "\nSW coefficients file: " << rrtmgp_coefficients_file_sw
-                   << "\nFrequency (timesteps) of Shortwave Radiation calc: " << dt
-                   << "\nFrequency (timesteps) of Longwave Radiation calc:  " << dt
-                   << "\nDo aerosol radiative calculations: " << do_aerosol_rad << std::endl;
-
-}
-
-
-// run radiation model
-void Radiation::run ()
-{
     // Cosine solar zenith angle for all columns in chunk
     coszrs = real1d("coszrs", ncol);
 
@@ -322,9 +343,56 @@ void Radiation::run ()
     // Gas volume mixing ratios
     gas_vmr = real3d("gas_vmr", ngas, ncol, nlev);
 
-    // Needed for shortwave aerosol;
-    //int nday, nnight;     // Number of daylight columns
-    int1d day_indices("day_indices", ncol), night_indices("night_indices", ncol);   // Indices of daylight coumns
+    // Indices of daylight and night columns
+    day_indices   = int1d("day_indices", ncol);
+    night_indices = int1d("night_indices", ncol);
+
+    gpoint_bands_sw = int1d("gpoint_bands_sw", nswgpts);
+    gpoint_bands_lw = int1d("gpoint_bands_lw", nlwgpts);
+
+    // Radiative fluxes
+    internal::initial_fluxes(ncol, nlev+1, nswbands, sw_fluxes_allsky);
+    internal::initial_fluxes(ncol, nlev+1, nswbands, sw_fluxes_clrsky);
+    internal::initial_fluxes(ncol, nlev, nlwbands, lw_fluxes_allsky);
+    internal::initial_fluxes(ncol, nlev, nlwbands, lw_fluxes_clrsky);
+
+    // Band reordering buffers
+    cld_tau_bnd_sw_1d = real1d("cld_tau_bnd_sw_1d", nswbands);
+    cld_ssa_bnd_sw_1d = real1d("cld_ssa_bnd_sw_1d", nswbands);
+    cld_asm_bnd_sw_1d = real1d("cld_asm_bnd_sw_1d", nswbands);
+    cld_tau_bnd_sw_o_1d = real1d("cld_tau_bnd_sw_1d", nswbands);
+    cld_ssa_bnd_sw_o_1d = real1d("cld_ssa_bnd_sw_1d", nswbands);
+    cld_asm_bnd_sw_o_1d = real1d("cld_asm_bnd_sw_1d", nswbands);
+
+    // The optics keep references to zi, pmid, pdel, tmid and qt, which are
+    // refilled in place by initialize(), so they only need to see new arrays
+    int nmodes = 3;
+    int nrh = 1;
+    int top_lev = 1;
+    naer = 4;
+    std::vector<std::string> aero_names {"H2O", "N2", "O2", "O3"};
+    geom_radius = real2d("geom_radius", ncol, nlev);
+    yakl::memset(geom_radius, 0.1);
+
+    optics.initialize(ngas, nmodes, naer, nswbands, nlwbands,
+                      ncol, nlev, nrh, top_lev, aero_names, zi,
+                      pmid, pdel, tmid, qt, geom_radius);
+
+    m_ws_ncol = ncol;
+    m_ws_nlev = nlev;
+
+    amrex::Print() << "LW coefficients file: " << rrtmgp_coefficients_file_lw
+                   << "\nSW coefficients file: " << rrtmgp_coefficients_file_sw
+                   << "\nFrequency (timesteps) of Shortwave Radiation calc: " << dt
+                   << "\nFrequency (timesteps) of Longwave Radiation calc:  " << dt
+                   << "\nDo aerosol radiative calculations: " << do_aerosol_rad
+                   << "\nRadiation columns on rank 0: " << ncol << " (" << m_coarsen << "x" << m_coarsen << " cells each)" << std::endl;
+}
+
+// run radiation model
+void Radiation::run ()
+{
+    BL_PROFILE("Radiation::run()");
 
     // Flag to carry (QRS,QRL)*dp across time steps.
     // TODO: what does this mean?
@@ -333,29 +401,41 @@ void Radiation::run ()
     // For loops over diagnostic calls
     //bool active_calls(0:N_DIAG)
 
-    // Zero-array for cloud properties if not diagnosed by microphysics
-    real2d zeros("zeros", ncol, nlev);
-
-    gpoint_bands_sw = int1d("gpoint_bands_sw", nswgpts);
-    gpoint_bands_lw = int1d("gpoint_bands_lw", nlwgpts);
-
     // Do shortwave stuff...
+    m_day_columns.assign(rank_offsets.size(), 0.0);
     if (do_short_wave_rad) {
-        // Radiative fluxes
-        internal::initial_fluxes(ncol, nlev+1, nswbands, sw_fluxes_allsky);
-        internal::initial_fluxes(ncol, nlev+1, nswbands, sw_fluxes_clrsky);
+        yakl::fence();
+        Gpu::streamSynchronize();
+        const Real wt_sw = amrex::second();
+
+        // Radiative fluxes; night columns are never written by the shortwave
+        // driver so clear what the previous call left behind
+        internal::reset_fluxes(sw_fluxes_allsky);
+        internal::reset_fluxes(sw_fluxes_clrsky);
 
         // TODO: Integrate calendar day computation
         int calday = 1;
         // Get cosine solar zenith angle for current time step.
         if (m_lat) {
-            zenith(calday, m_lat, m_lon, rank_offsets, coszrs, ncol,
+            zenith(calday, m_lat, m_lon, rank_offsets, m_coarsen, coszrs, ncol,
                    eccen,  mvelpp, lambm0, obliqr);
         } else {
-            zenith(calday, m_lat, m_lon, rank_offsets, coszrs, ncol,
+            zenith(calday, m_lat, m_lon, rank_offsets, m_coarsen, coszrs, ncol,
                    eccen,  mvelpp, lambm0, obliqr, uniform_angle);
         }
 
+        // Count the daylit columns of each box; the shortwave work is proportional to them
+        {
+            realHost1d coszrs_host("coszrs_host", ncol);
+            coszrs.deep_copy_to(coszrs_host);
+            yakl::fence();
+            for (int ib = 0; ib < static_cast<int>(rank_offsets.size()); ++ib) {
+                for (int icol = rank_offsets[ib]+1; icol <= rank_offsets[ib]+box_ncols[ib]; ++icol) {
+                    if (coszrs_host(icol) > 0.) m_day_columns[ib] += 1.0;
+                }
+            }
+        }
+
         // Get albedo. This uses CAM routines internally and just provides a
         // wrapper to improve readability of the code here.
         set_albedo(coszrs, albedo_dir, albedo_dif);
@@ -390,13 +470,6 @@ void Radiation::run ()
         // We need to fix band ordering because the old input files assume RRTMG
         // band ordering, but this has changed in RRTMGP.
         // TODO: fix the input files themselves!
-        cld_tau_bnd_sw_1d = real1d("cld_tau_bnd_sw_1d", nswbands);
-        cld_ssa_bnd_sw_1d = real1d("cld_ssa_bnd_sw_1d", nswbands);
-        cld_asm_bnd_sw_1d = real1d("cld_asm_bnd_sw_1d", nswbands);
-        cld_tau_bnd_sw_o_1d = real1d("cld_tau_bnd_sw_1d", nswbands);
-        cld_ssa_bnd_sw_o_1d = real1d("cld_ssa_bnd_sw_1d", nswbands);
-        cld_asm_bnd_sw_o_1d = real1d("cld_asm_bnd_sw_1d", nswbands);
-
         parallel_for(SimpleBounds<2>(ncol, nlev), YAKL_LAMBDA (int icol, int ilay)
         {
             for (auto ibnd = 1; ibnd <= nswbands; ++ibnd) {
@@ -501,6 +574,11 @@ void Radiation::run ()
         // Set surface fluxes that are used by the land model
         export_surface_fluxes(sw_fluxes_allsky, "shortwave");
 
+        yakl::fence();
+        Gpu::streamSynchronize();
+        m_sw_wtime = amrex::second() - wt_sw;
+        m_sw_wtime_pending += m_sw_wtime;
+
     } else {
         // Conserve energy
         if (conserve_energy) {
@@ -513,9 +591,9 @@ void Radiation::run ()
 
     // Do longwave stuff...
     if (do_long_wave_rad) {
-        // Allocate longwave outputs; why is this not part of the fluxes_t object?
-        internal::initial_fluxes(ncol, nlev, nlwbands, lw_fluxes_allsky);
-        internal::initial_fluxes(ncol, nlev, nlwbands, lw_fluxes_clrsky);
+        yakl::fence();
+        Gpu::streamSynchronize();
+        const Real wt_lw = amrex::second();
 
         // NOTE: fluxes defined at interfaces, so initialize to have vertical dimension nlev_rad+1
         yakl::memset(cld_tau_gpt_lw, 0.);
@@ -546,6 +624,9 @@ void Radiation::run ()
         // Set surface fluxes that are used by the land model
         export_surface_fluxes(lw_fluxes_allsky, "longwave");
 
+        yakl::fence();
+        Gpu::streamSynchronize();
+        m_lw_wtime_pending += amrex::second() - wt_lw;
     }
     else {
         // Conserve energy (what does this mean exactly?)
@@ -557,16 +638,16 @@ void Radiation::run ()
         }
     } // dolw
 
-    // Populate source term for theta dycore variable
+    // Populate source term for theta dycore variable; every cell of a
+    // coarsened column gets the heating rate of that column
     for (MFIter mfi(*(qrad_src)); mfi.isValid(); ++mfi) {
         auto qrad_src_array = qrad_src->array(mfi);
-        const auto& box3d = mfi.tilebox();
-        auto nx = box3d.length(0);
-        int const offset = rank_offsets[mfi.LocalIndex()];
+        const auto& box3d = mfi.validbox();
+        const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
         amrex::ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
         {
             // Map (col,lev) to (i,j,k)
-            auto icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+            auto icol = cmap(i,j);
             auto ilev = k+1;
 
             // TODO: We do not include the cloud source term qrsc/qrlc.
@@ -591,9 +672,8 @@ void Radiation::radiation_driver_sw (int ncol, const real3d& gas_vmr,
     // and earth-sun distance
     real2d solar_irradiance_by_gpt("solar_irradiance_by_gpt",ncol,nswgpts);
 
-    // Gathered indices of day and night columns
+    // Gathered indices of day and night columns are kept in day_indices / night_indices
     // chunk_column_index = day_indices(daylight_column_index)
-    int1d day_indices("day_indices",ncol), night_indices("night_indices", ncol);   // Indices of daylight coumns
 
     real1d coszrs_day("coszrs_day", ncol);
     real2d albedo_dir_day("albedo_dir_day", nswbands, ncol), albedo_dif_day("albedo_dif_day", nswbands, ncol);
@@ -1009,13 +1089,12 @@ Radiation::export_surface_fluxes(FluxesByband& fluxes,
         // Populate the LSM data structure (this is a 2D MF)
         for (MFIter mfi(*(m_lsm_fluxes)); mfi.isValid(); ++mfi) {
             auto lsm_array = m_lsm_fluxes->array(mfi);
-            const auto& box3d = mfi.tilebox();
-            auto nx = box3d.length(0);
-            const int offset = rank_offsets[mfi.LocalIndex()];
+            const auto& box3d = mfi.validbox();
+            const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
             amrex::ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
             {
                 // Map (col,lev) to (i,j,k)
-                auto icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+                auto icol = cmap(i,j);
                 auto ilev = k+1;
 
                 // Direct fluxes
@@ -1052,13 +1131,12 @@ Radiation::export_surface_fluxes(FluxesByband& fluxes,
         // Populate the LSM data structure (this is a 2D MF)
         for (MFIter mfi(*(m_lsm_fluxes)); mfi.isValid(); ++mfi) {
             auto lsm_array = m_lsm_fluxes->array(mfi);
-            const auto& box3d = mfi.tilebox();
-            auto nx = box3d.length(0);
-            const int offset = rank_offsets[mfi.LocalIndex()];
+            const auto& box3d = mfi.validbox();
+            const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
             amrex::ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
             {
                 // Map (col,lev) to (i,j,k)
-                auto icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+                auto icol = cmap(i,j);
                 auto ilev = k+1;
 
                 // Net fluxes
@@ -1087,13 +1165,12 @@ void Radiation::yakl_to_mf(const real2d &data, amrex::MultiFab &mf)
 
     for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
         auto mf_arr = mf.array(mfi);
-        const auto& box3d = mfi.tilebox();
-        const int nx = box3d.length(0);
-        const int offset = rank_offsets[mfi.LocalIndex()];
+        const auto& box3d = mfi.validbox();
+        const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
         amrex::ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
         {
             // map [i,j,k] 0-based to [icol, ilev] 1-based
-            const int icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+            const int icol = cmap(i,j);
             const int ilev = k+1;
             AMREX_ASSERT(icol <= static_cast<int>(data.get_dimensions()(1)));
             AMREX_ASSERT(ilev <= static_cast<int>(data.get_dimensions()(2)));
@@ -1116,13 +1193,12 @@ void Radiation::expand_yakl1d_to_mf(const real1d &data, amrex::MultiFab &mf)
 
     for (MFIter mfi(mf); mfi.isValid(); ++mfi) {
         auto mf_arr = mf.array(mfi);
-        const auto& box3d = mfi.tilebox();
-        const int nx = box3d.length(0);
-        const int offset = rank_offsets[mfi.LocalIndex()];
+        const auto& box3d = mfi.validbox();
+        const RadColumnMap cmap(box3d, m_coarsen, rank_offsets[mfi.LocalIndex()]);
         amrex::ParallelFor(box3d, [=] AMREX_GPU_DEVICE (int i, int j, int k)
         {
             // map [i,j,k] 0-based to [icol, ilev] 1-based
-            const int icol = (j-box3d.smallEnd(1))*nx + (i-box3d.smallEnd(0)) + 1 + offset;
+            const int icol = cmap(i,j);
             AMREX_ASSERT(icol <= static_cast<int>(data.get_dimensions()(1)));
             mf_arr(i, j, k) = data(icol);
         });
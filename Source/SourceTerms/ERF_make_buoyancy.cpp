@@ -19,14 +19,12 @@ using namespace amrex;
  * @param[in]  S_data        current solution
  * @param[in]  S_prim        primitive variables (i.e. conserved variables divided by density)
  * @param[out] buoyancy      buoyancy term computed here
- * @param[in]  qmoist        moisture variables (in order: qv, qc, qi, ...)
- * @param[in]  qv_d          lateral average of cloud vapor
- * @param[in]  qc_d          lateral average of cloud vapor
- * @param[in]  qd_d          lateral average of cloud vapor
  * @param[in]  geom          Container for geometric information
  * @param[in]  solverChoice  Container for solver parameters
  * @param[in]  r0            Reference (hydrostatically stratified) density
  * @param[in]  n_qstate      Number of moist variables used by the current model
+ * @param[in]  anelastic     Whether the anelastic approximation is used at this level
+ * @param[in,out] state_means horizontal means of the state, computed here if not yet current
  */
 
 void make_buoyancy (Vector<MultiFab>& S_data,
@@ -37,7 +35,8 @@ void make_buoyancy (Vector<MultiFab>& S_data,
                     const MultiFab* r0,
                     const MultiFab* p0,
                     const int n_qstate,
-                    const int anelastic)
+                    const int anelastic,
+                    StateHorizontalMeans& state_means)
 {
     BL_PROFILE("make_buoyancy()");
 
@@ -211,45 +210,14 @@ void make_buoyancy (Vector<MultiFab>& S_data,
 
           } else {
 
-            PlaneAverage state_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane);
-            PlaneAverage  prim_ave(&S_prim                , geom, solverChoice.ave_plane);
-
-            // Compute horizontal averages of all components of each field
-            state_ave.compute_averages(ZDir(), state_ave.field());
-            prim_ave.compute_averages(ZDir(), prim_ave.field());
-
-            int ncell = state_ave.ncell_line();
-
-            Gpu::HostVector  <Real> rho_h(ncell), theta_h(ncell);
-            Gpu::DeviceVector<Real> rho_d(ncell), theta_d(ncell);
-
-            state_ave.line_average(Rho_comp, rho_h);
-            Gpu::copyAsync(Gpu::hostToDevice, rho_h.begin(), rho_h.end(), rho_d.begin());
-
-            prim_ave.line_average(PrimTheta_comp, theta_h);
-            Gpu::copyAsync(Gpu::hostToDevice, theta_h.begin(), theta_h.end(), theta_d.begin());
-
-            Real*   rho_d_ptr =   rho_d.data();
-            Real* theta_d_ptr = theta_d.data();
-
-            // Average valid moisture vars
-            Gpu::HostVector  <Real> qv_h(ncell)    , qc_h(ncell)    , qp_h(ncell);
-            Gpu::DeviceVector<Real> qv_d(ncell,0.0), qc_d(ncell,0.0), qp_d(ncell,0.0);
-            if (n_qstate >=1) {
-                prim_ave.line_average(PrimQ1_comp, qv_h);
-               Gpu::copyAsync(Gpu::hostToDevice,  qv_h.begin(), qv_h.end(), qv_d.begin());
-            }
-            if (n_qstate >=2) {
-                prim_ave.line_average(PrimQ2_comp, qc_h);
-                Gpu::copyAsync(Gpu::hostToDevice,  qc_h.begin(), qc_h.end(), qc_d.begin());
-            }
-            if (n_qstate >=3) {
-                prim_ave.line_average(PrimQ3_comp, qp_h);
-                Gpu::copyAsync(Gpu::hostToDevice,  qp_h.begin(), qp_h.end(), qp_d.begin());
-            }
-            Real* qv_d_ptr = qv_d.data();
-            Real* qc_d_ptr = qc_d.data();
-            Real* qp_d_ptr = qp_d.data();
+            // Horizontal means of the state, shared with the other slow source terms of this stage
+            state_means.update(S_data[IntVars::cons], S_prim);
+
+            const auto   rho_d_ptr = state_means.table(StateHorizontalMeans::rho);
+            const auto theta_d_ptr = state_means.table(StateHorizontalMeans::theta);
+            const auto    qv_d_ptr = state_means.table(StateHorizontalMeans::qv);
+            const auto    qc_d_ptr = state_means.table(StateHorizontalMeans::qc);
+            const auto    qp_d_ptr = state_means.table(StateHorizontalMeans::qp);
 
             if (solverChoice.buoyancy_type == 2 || solverChoice.buoyancy_type == 4 ) {
 
@@ -272,8 +240,8 @@ void make_buoyancy (Vector<MultiFab>& S_data,
                     // TODO: ice has not been dealt with (q1=qv, q2=qv, q3=qp)
                     ParallelFor(tbz, [=, buoyancy_type=solverChoice.buoyancy_type] AMREX_GPU_DEVICE (int i, int j, int k)
                     {
-                        Real tempp1d = getTgivenRandRTh(rho_d_ptr[k  ], rho_d_ptr[k  ]*theta_d_ptr[k  ], qv_d_ptr[k  ]);
-                        Real tempm1d = getTgivenRandRTh(rho_d_ptr[k-1], rho_d_ptr[k-1]*theta_d_ptr[k-1], qv_d_ptr[k-1]);
+                        Real tempp1d = getTgivenRandRTh(rho_d_ptr(k  ), rho_d_ptr(k  )*theta_d_ptr(k  ), qv_d_ptr(k  ));
+                        Real tempm1d = getTgivenRandRTh(rho_d_ptr(k-1), rho_d_ptr(k-1)*theta_d_ptr(k-1), qv_d_ptr(k-1));
 
                         Real tempp3d  = getTgivenRandRTh(cell_data(i,j,k  ,Rho_comp),
                                                          cell_data(i,j,k  ,RhoTheta_comp),
@@ -294,30 +262,30 @@ void make_buoyancy (Vector<MultiFab>& S_data,
                         Real qp_minus = (n_qstate >= 3) ? cell_prim(i,j,k-1,PrimQ3_comp) : 0.0;
 
                         if (buoyancy_type == 2) {
-                            qplus  = 0.61 * ( qv_plus - qv_d_ptr[k] ) -
-                                            ( qc_plus - qc_d_ptr[k]   +
-                                              qp_plus - qp_d_ptr[k] )
-                                   + (tempp3d-tempp1d)/tempp1d*(Real(1.0) + Real(0.61)*qv_d_ptr[k]-qc_d_ptr[k]-qp_d_ptr[k]);
+                            qplus  = 0.61 * ( qv_plus - qv_d_ptr(k) ) -
+                                            ( qc_plus - qc_d_ptr(k)   +
+                                              qp_plus - qp_d_ptr(k) )
+                                   + (tempp3d-tempp1d)/tempp1d*(Real(1.0) + Real(0.61)*qv_d_ptr(k)-qc_d_ptr(k)-qp_d_ptr(k));
 
-                            qminus = 0.61 * ( qv_minus - qv_d_ptr[k-1] ) -
-                                            ( qc_minus - qc_d_ptr[k-1]   +
-                                              qp_minus - qp_d_ptr[k-1] )
-                                   + (tempm3d-tempm1d)/tempm1d*(Real(1.0) + Real(0.61)*qv_d_ptr[k-1]-qc_d_ptr[k-1]-qp_d_ptr[k-1]);
+                            qminus = 0.61 * ( qv_minus - qv_d_ptr(k-1) ) -
+                                            ( qc_minus - qc_d_ptr(k-1)   +
+                                              qp_minus - qp_d_ptr(k-1) )
+                                   + (tempm3d-tempm1d)/tempm1d*(Real(1.0) + Real(0.61)*qv_d_ptr(k-1)-qc_d_ptr(k-1)-qp_d_ptr(k-1));
 
                         } else { // (buoyancy_type == 4)
-                            qplus  = 0.61 * ( qv_plus - qv_d_ptr[k] ) -
-                                            ( qc_plus - qc_d_ptr[k]   +
-                                              qp_plus - qp_d_ptr[k] )
-                                   + (cell_data(i,j,k  ,RhoTheta_comp)/cell_data(i,j,k  ,Rho_comp) - theta_d_ptr[k  ])/theta_d_ptr[k  ];
-
-                            qminus = 0.61 * ( qv_minus - qv_d_ptr[k-1] ) -
-                                            ( qc_minus - qc_d_ptr[k-1]   +
-                                              qp_minus - qp_d_ptr[k-1] )
-                                   + (cell_data(i,j,k-1,RhoTheta_comp)/cell_data(i,j,k-1,Rho_comp) - theta_d_ptr[k-1])/theta_d_ptr[k-1];
+                            qplus  = 0.61 * ( qv_plus - qv_d_ptr(k) ) -
+                                            ( qc_plus - qc_d_ptr(k)   +
+                                              qp_plus - qp_d_ptr(k) )
+                                   + (cell_data(i,j,k  ,RhoTheta_comp)/cell_data(i,j,k  ,Rho_comp) - theta_d_ptr(k  ))/theta_d_ptr(k  );
+
+                            qminus = 0.61 * ( qv_minus - qv_d_ptr(k-1) ) -
+                                            ( qc_minus - qc_d_ptr(k-1)   +
+                                              qp_minus - qp_d_ptr(k-1) )
+                                   + (cell_data(i,j,k-1,RhoTheta_comp)/cell_data(i,j,k-1,Rho_comp) - theta_d_ptr(k-1))/theta_d_ptr(k-1);
                         }
 
                         Real qavg  = Real(0.5) * (qplus + qminus);
-                        Real r0avg = Real(0.5) * (rho_d_ptr[k] + rho_d_ptr[k-1]);
+                        Real r0avg = Real(0.5) * (rho_d_ptr(k) + rho_d_ptr(k-1));
 
                         buoyancy_fab(i, j, k) = -qavg * r0avg * grav_gpu[2];
                     });
@@ -344,8 +312,8 @@ void make_buoyancy (Vector<MultiFab>& S_data,
 
                     ParallelFor(tbz, [=] AMREX_GPU_DEVICE (int i, int j, int k)
                     {
-                        Real tempp1d = getTgivenRandRTh(rho_d_ptr[k  ], rho_d_ptr[k  ]*theta_d_ptr[k  ], qv_d_ptr[k  ]);
-                        Real tempm1d = getTgivenRandRTh(rho_d_ptr[k-1], rho_d_ptr[k-1]*theta_d_ptr[k-1], qv_d_ptr[k-1]);
+                        Real tempp1d = getTgivenRandRTh(rho_d_ptr(k  ), rho_d_ptr(k  )*theta_d_ptr(k  ), qv_d_ptr(k  ));
+                        Real tempm1d = getTgivenRandRTh(rho_d_ptr(k-1), rho_d_ptr(k-1)*theta_d_ptr(k-1), qv_d_ptr(k-1));
 
                         Real tempp3d  = getTgivenRandRTh(cell_data(i,j,k  ,Rho_comp),
                                                          cell_data(i,j,k  ,RhoTheta_comp),
@@ -368,7 +336,7 @@ void make_buoyancy (Vector<MultiFab>& S_data,
                         Real qminus = 0.61 * qv_minus - (qc_minus + qp_minus) + (tempm3d-tempm1d)/tempm1d;
 
                         Real qavg  = Real(0.5) * (qplus + qminus);
-                        Real r0avg = Real(0.5) * (rho_d_ptr[k] + rho_d_ptr[k-1]);
+                        Real r0avg = Real(0.5) * (rho_d_ptr(k) + rho_d_ptr(k-1));
 
                         buoyancy_fab(i, j, k) = -qavg * r0avg * grav_gpu[2];
                     });
@@ -35,6 +35,7 @@ using namespace amrex;
  * @param[in] dptr_wbar_sub  subsidence source term
  * @param[in] d_rayleigh_ptrs_at_lev  Vector of {strength of Rayleigh damping, reference value for xvel/yvel/zvel/theta} used to define Rayleigh damping
  * @param[in] n_qstate number of moisture components
+ * @param[in,out] state_means horizontal means of the state, computed here if not yet current
  */
 
 void make_mom_sources (int level,
@@ -60,7 +61,8 @@ void make_mom_sources (int level,
                        const Vector<Real*> d_rayleigh_ptrs_at_lev,
                        const Vector<Real*> d_sponge_ptrs_at_lev,
                        InputSoundingData& input_sounding_data,
-                       int n_qstate)
+                       int n_qstate,
+                       StateHorizontalMeans& state_means)
 {
     BL_PROFILE_REGION("erf_make_mom_sources()");
 
@@ -114,35 +116,15 @@ void make_mom_sources (int level,
     // *****************************************************************************
     // Planar averages for subsidence terms
     // *****************************************************************************
-    Table1D<Real>     dptr_r_plane, dptr_u_plane, dptr_v_plane;
-    TableData<Real, 1> r_plane_tab,  u_plane_tab,  v_plane_tab;
+    Table1D<const Real> dptr_r_plane;
+    Table1D<Real>       dptr_u_plane, dptr_v_plane;
+    TableData<Real, 1>  u_plane_tab,  v_plane_tab;
 
     if (dptr_wbar_sub || solverChoice.nudging_from_input_sounding)
     {
-        // Rho
-        PlaneAverage r_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane, true);
-        r_ave.compute_averages(ZDir(), r_ave.field());
-
-        int ncell = r_ave.ncell_line();
-        Gpu::HostVector<    Real> r_plane_h(ncell);
-        Gpu::DeviceVector<  Real> r_plane_d(ncell);
-
-        r_ave.line_average(Rho_comp, r_plane_h);
-
-        Gpu::copyAsync(Gpu::hostToDevice, r_plane_h.begin(), r_plane_h.end(), r_plane_d.begin());
-
-        Real* dptr_r = r_plane_d.data();
-
-        IntVect ng_c = S_data[IntVars::cons].nGrowVect();
-        Box tdomain  = domain; tdomain.grow(2,ng_c[2]);
-        r_plane_tab.resize({tdomain.smallEnd(2)}, {tdomain.bigEnd(2)});
-
-        int offset = ng_c[2];
-        dptr_r_plane = r_plane_tab.table();
-        ParallelFor(ncell, [=] AMREX_GPU_DEVICE (int k) noexcept
-        {
-            dptr_r_plane(k-offset) = dptr_r[k];
-        });
+        // Rho, shared with the scalar sources and the buoyancy of this stage
+        state_means.update(S_data[IntVars::cons], S_prim);
+        dptr_r_plane = state_means.table(StateHorizontalMeans::rho);
 
         // U and V momentum
         PlaneAverage u_ave(&(S_data[IntVars::xmom]), geom, solverChoice.ave_plane, true);
@@ -191,7 +173,7 @@ void make_mom_sources (int level,
     // 1. Create the BUOYANCY forcing term in the z-direction
     // *****************************************************************************
     make_buoyancy(S_data, S_prim, zmom_src, geom, solverChoice, r0, p0,
-                  n_qstate, solverChoice.anelastic[level]);
+                  n_qstate, solverChoice.anelastic[level], state_means);
 
     // *****************************************************************************
     // Add all the other forcings
@@ -27,6 +27,7 @@ using namespace amrex;
  * @param[in] dptr_rhoqt_src  custom moisture source term
  * @param[in] dptr_wbar_sub  subsidence source term
  * @param[in] d_rayleigh_ptrs_at_lev  Vector of {strength of Rayleigh damping, reference value of theta} used to define Rayleigh damping
+ * @param[in,out] state_means  horizontal means of the state, computed here if not yet current
  */
 
 void make_sources (int level,
@@ -47,7 +48,8 @@ void make_sources (int level,
                    const Real* dptr_wbar_sub,
                    const Vector<Real*> d_rayleigh_ptrs_at_lev,
                    InputSoundingData& input_sounding_data,
-                   TurbulentPerturbation& turbPert)
+                   TurbulentPerturbation& turbPert,
+                   StateHorizontalMeans& state_means)
 {
     BL_PROFILE_REGION("erf_make_sources()");
 
@@ -63,8 +65,6 @@ void make_sources (int level,
     const bool l_use_deardorff  = (tc.les_type == LESType::Deardorff);
     const bool l_use_QKE        = tc.use_QKE && tc.diffuse_QKE_3D;
 
-    const Box& domain = geom.Domain();
-
     const GpuArray<Real, AMREX_SPACEDIM> dxInv = geom.InvCellSizeArray();
 
     Real* thetabar = d_rayleigh_ptrs_at_lev[Rayleigh::thetabar];
@@ -72,86 +72,19 @@ void make_sources (int level,
     // *****************************************************************************
     // Planar averages for subsidence terms
     // *****************************************************************************
-    Table1D<Real>      dptr_r_plane, dptr_t_plane, dptr_qv_plane, dptr_qc_plane;
-    TableData<Real, 1>  r_plane_tab,  t_plane_tab,  qv_plane_tab,  qc_plane_tab;
+    Table1D<const Real> dptr_r_plane, dptr_t_plane, dptr_qv_plane, dptr_qc_plane;
     if (dptr_wbar_sub || solverChoice.nudging_from_input_sounding)
     {
-        // Rho
-        PlaneAverage r_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane, true);
-        r_ave.compute_averages(ZDir(), r_ave.field());
-
-        int ncell = r_ave.ncell_line();
-        Gpu::HostVector<    Real> r_plane_h(ncell);
-        Gpu::DeviceVector<  Real> r_plane_d(ncell);
-
-        r_ave.line_average(Rho_comp, r_plane_h);
-
-        Gpu::copyAsync(Gpu::hostToDevice, r_plane_h.begin(), r_plane_h.end(), r_plane_d.begin());
-
-        Real* dptr_r = r_plane_d.data();
-
-        IntVect ng_c = S_data[IntVars::cons].nGrowVect();
-        Box tdomain  = domain; tdomain.grow(2,ng_c[2]);
-        r_plane_tab.resize({tdomain.smallEnd(2)}, {tdomain.bigEnd(2)});
-
-        int offset = ng_c[2];
-        dptr_r_plane = r_plane_tab.table();
-        ParallelFor(ncell, [=] AMREX_GPU_DEVICE (int k) noexcept
-        {
-            dptr_r_plane(k-offset) = dptr_r[k];
-        });
-
-        // Rho * Theta
-        PlaneAverage t_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane, true);
-        t_ave.compute_averages(ZDir(), t_ave.field());
+        // Means of rho, rho theta, rho qv and rho qc, shared with the buoyancy of this stage
+        state_means.update(S_data[IntVars::cons], S_prim);
 
-        Gpu::HostVector<    Real> t_plane_h(ncell);
-        Gpu::DeviceVector<  Real> t_plane_d(ncell);
-
-        t_ave.line_average(RhoTheta_comp, t_plane_h);
-
-        Gpu::copyAsync(Gpu::hostToDevice, t_plane_h.begin(), t_plane_h.end(), t_plane_d.begin());
-
-        Real* dptr_t = t_plane_d.data();
-
-        t_plane_tab.resize({tdomain.smallEnd(2)}, {tdomain.bigEnd(2)});
-
-        dptr_t_plane = t_plane_tab.table();
-        ParallelFor(ncell, [=] AMREX_GPU_DEVICE (int k) noexcept
-        {
-            dptr_t_plane(k-offset) = dptr_t[k];
-        });
+        dptr_r_plane = state_means.table(StateHorizontalMeans::rho);
+        dptr_t_plane = state_means.table(StateHorizontalMeans::rhotheta);
 
         if (solverChoice.moisture_type != MoistureType::None)
         {
-            Gpu::HostVector<  Real> qv_plane_h(ncell), qc_plane_h(ncell);
-            Gpu::DeviceVector<Real> qv_plane_d(ncell), qc_plane_d(ncell);
-
-            // Water vapor
-            PlaneAverage qv_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane, true);
-            qv_ave.compute_averages(ZDir(), qv_ave.field());
-            qv_ave.line_average(RhoQ1_comp, qv_plane_h);
-            Gpu::copyAsync(Gpu::hostToDevice, qv_plane_h.begin(), qv_plane_h.end(), qv_plane_d.begin());
-
-            // Cloud water
-            PlaneAverage qc_ave(&(S_data[IntVars::cons]), geom, solverChoice.ave_plane, true);
-            qc_ave.compute_averages(ZDir(), qc_ave.field());
-            qc_ave.line_average(RhoQ2_comp, qc_plane_h);
-            Gpu::copyAsync(Gpu::hostToDevice, qc_plane_h.begin(), qc_plane_h.end(), qc_plane_d.begin());
-
-            Real* dptr_qv = qv_plane_d.data();
-            Real* dptr_qc = qc_plane_d.data();
-
-            qv_plane_tab.resize({tdomain.smallEnd(2)}, {tdomain.bigEnd(2)});
-            qc_plane_tab.resize({tdomain.smallEnd(2)}, {tdomain.bigEnd(2)});
-
-            dptr_qv_plane = qv_plane_tab.table();
-            dptr_qc_plane = qc_plane_tab.table();
-            ParallelFor(ncell, [=] AMREX_GPU_DEVICE (int k) noexcept
-            {
-                dptr_qv_plane(k-offset) = dptr_qv[k];
-                dptr_qc_plane(k-offset) = dptr_qc[k];
-            });
+            dptr_qv_plane = state_means.table(StateHorizontalMeans::rhoqv);
+            dptr_qc_plane = state_means.table(StateHorizontalMeans::rhoqc);
         }
     }
 
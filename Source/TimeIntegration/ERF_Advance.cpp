@@ -107,8 +107,14 @@ ERF::Advance (int lev, Real time, Real dt_lev, int iteration, int /*ncycle*/)
                        Geom(lev).Domain(),
                        domain_bcs_type);
 
+    // The dycore kernels charge their wall time on each box to box_costs for load balancing
+    get_box_costs(lev);
+
 #if defined(ERF_USE_WINDFARM)
     if (solverChoice.windfarm_type != WindFarmType::None) {
+        // The model box loops charge their wall time to box_costs; the reductions over
+        // the turbines are not charged
+        windfarm->set_box_costs(get_box_costs(lev));
         advance_windfarm(Geom(lev), dt_lev, S_old,
                          U_old, V_old, W_old, vars_windfarm[lev], Nturb[lev], SMark[lev]);
     }
@@ -182,7 +188,13 @@ ERF::Advance (int lev, Real time, Real dt_lev, int iteration, int /*ncycle*/)
     // **************************************************************************************
     // Update the radiation
     // **************************************************************************************
-    advance_radiation(lev, S_new, dt_lev);
+    advance_radiation(lev, S_new, time + dt_lev, dt_lev);
+    if (load_balance_int > 0) {
+        // The shortwave part only works on daylit columns, so charge it by those;
+        // the longwave part works on every column
+        add_box_costs(lev, rad[lev]->take_sw_wtime(), rad[lev]->day_columns());
+        add_box_costs(lev, rad[lev]->take_lw_wtime());
+    }
 #endif
 
 #ifdef ERF_USE_PARTICLES
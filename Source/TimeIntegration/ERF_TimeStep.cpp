@@ -53,6 +53,11 @@ ERF::timeStep (int lev, Real time, int /*iteration*/)
         } // lev
     }
 
+    // Redistribute this level using the box costs measured since the last rebalance
+    if (load_balance_int > 0 && istep[lev] > 0 && istep[lev] % load_balance_int == 0) {
+        load_balance(lev);
+    }
+
     // Update what we call "old" and "new" time
     t_old[lev] = t_new[lev];
     t_new[lev] += dt[lev];
@@ -73,6 +78,11 @@ ERF::timeStep (int lev, Real time, int /*iteration*/)
     //send_to_ww3(lev);
 #endif
 
+#ifdef ERF_USE_NETCDF
+    // Finer levels advance within the level 0 step so this covers them too
+    if (lev == 0) update_wrfbdy_window(time, dt[lev]);
+#endif
+
     // Advance a single level for a single time step
     Advance(lev, time, dt[lev], istep[lev], nsubsteps[lev]);
 
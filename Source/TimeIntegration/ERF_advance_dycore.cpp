@@ -5,6 +5,7 @@
 #include <ERF_MRI.H>
 #include <ERF_EddyViscosity.H>
 #include <ERF_EOS.H>
+#include <ERF_PlaneAverage.H>
 #include <ERF_TerrainMetrics.H>
 #include <ERF_Diffusion.H>
 #include <ERF_TileNoZ.H>
@@ -105,6 +106,11 @@ void ERF::advance_dycore(int level,
     MultiFab    S_prim  (ba  , dm, num_prim,          state_old[IntVars::cons].nGrowVect());
     MultiFab  pi_stage  (ba  , dm,        1,          state_old[IntVars::cons].nGrowVect());
     MultiFab fast_coeffs(ba_z, dm,        5,          0);
+
+    // Horizontal means of the state shared by the slow source terms, computed at most once per stage
+    StateHorizontalMeans state_means(domain, state_old[IntVars::cons].nGrowVect()[2], micro->Get_Qstate_Size(),
+                                     solverChoice.ave_plane);
+
     MultiFab* eddyDiffs = eddyDiffs_lev[level].get();
     MultiFab* SmnSmn    = SmnSmn_lev[level].get();
 
@@ -10,7 +10,20 @@ void ERF::advance_microphysics (int lev,
 {
     if (solverChoice.moisture_type != MoistureType::None) {
         micro->Update_Micro_Vars_Lev(lev, cons);
+
+        // Only the column work is charged for load balancing, not the FillBoundary
+        //    done when the state is updated
+        Real wt = 0.0;
+        if (load_balance_int > 0) {
+            Gpu::streamSynchronize();
+            wt = amrex::second();
+        }
         micro->Advance(lev, dt_advance, iteration, time, solverChoice, vars_new, z_phys_nd);
+        if (load_balance_int > 0) {
+            Gpu::streamSynchronize();
+            add_box_costs(lev, amrex::second() - wt);
+        }
+
         micro->Update_State_Vars_Lev(lev, cons);
     }
 }
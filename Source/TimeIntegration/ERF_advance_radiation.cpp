@@ -3,32 +3,150 @@
 using namespace amrex;
 
 #if defined(ERF_USE_RRTMGP)
+/**
+ * Update the radiative heating rates at one level
+ *
+ * Radiation is called when at least rad_interval seconds have passed since the last call at
+ * this level (every step when rad_interval <= 0), and after the grids of the level change.
+ * Between calls the heating rates from the last call are held, or extrapolated linearly from
+ * the last two calls when rad_extrapolate is set. With rad_coarsen > 1 radiation runs on
+ * averaged columns, and rad_coarsen_check compares each call against a full-resolution one.
+ *
+ * @param[in]    lev        level of refinement
+ * @param[in]    cons       conserved state at the new time
+ * @param[in]    time       new time of this level
+ * @param[in]    dt_advance time step of this level
+ */
 void ERF::advance_radiation (int lev,
                              MultiFab& cons,
+                             const Real& time,
                              const Real& dt_advance)
 {
-   bool do_sw_rad {true};
-   bool do_lw_rad {true};
-   bool do_aero_rad {true};
-   bool do_snow_opt {true};
-   bool is_cmip6_volcano {false};
-
-    rad.initialize(cons,
-                   sw_lw_fluxes[lev].get(),
-                   solar_zenith[lev].get(),
-                   qheating_rates[lev].get(),
-                   lat_m[lev].get(),
-                   lon_m[lev].get(),
-                   qmoist[lev],
-                   grids[lev],
-                   Geom(lev),
-                   dt_advance,
-                   do_sw_rad,
-                   do_lw_rad,
-                   do_aero_rad,
-                   do_snow_opt,
-                   is_cmip6_volcano);
-    rad.run();
-    rad.on_complete();
+    BL_PROFILE("ERF::advance_radiation()");
+
+    // Call radiation once we are within half a step of the next radiation time
+    const bool do_rad_call = (rad_interval <= 0.0) || (rad_ncalls[lev] == 0) ||
+                             (time - rad_time_last[lev] >= rad_interval - 0.5*dt_advance);
+
+    if (!do_rad_call) {
+        if (rad_extrapolate && rad_ncalls[lev] > 1) {
+            // q(t) = q_last + (t - t_last) * (q_last - q_prev) / (t_last - t_prev)
+            const Real fac = (time - rad_time_last[lev]) / (rad_time_last[lev] - rad_time_prev[lev]);
+            MultiFab::LinComb(*qheating_rates[lev],
+                              1.0 + fac, *qheating_rates_last[lev], 0,
+                                   -fac, *qheating_rates_prev[lev], 0,
+                              0, 2, 0);
+        }
+        return;
+    }
+
+    bool do_sw_rad {true};
+    bool do_lw_rad {true};
+    bool do_aero_rad {true};
+    bool do_snow_opt {true};
+    bool is_cmip6_volcano {false};
+
+    rad[lev]->initialize(cons,
+                         sw_lw_fluxes[lev].get(),
+                         solar_zenith[lev].get(),
+                         qheating_rates[lev].get(),
+                         lat_m[lev].get(),
+                         lon_m[lev].get(),
+                         qmoist[lev],
+                         grids[lev],
+                         Geom(lev),
+                         dt_advance,
+                         do_sw_rad,
+                         do_lw_rad,
+                         do_aero_rad,
+                         do_snow_opt,
+                         is_cmip6_volcano);
+    rad[lev]->run();
+    rad[lev]->on_complete();
+
+    // Per-rank shortwave report: the shortwave work is only done on daylit columns,
+    // so near the terminator it can be badly balanced even when the cells are not
+    if (verbose > 0) {
+        Real ndays = 0.0;
+        for (const auto& n : rad[lev]->day_columns()) { ndays += n; }
+        Real wt_sw = rad[lev]->sw_wtime();
+
+        Real ndays_min(ndays), ndays_max(ndays), ndays_avg(ndays);
+        Real wt_min(wt_sw), wt_max(wt_sw), wt_avg(wt_sw);
+        ParallelDescriptor::ReduceRealMin(ndays_min);
+        ParallelDescriptor::ReduceRealMax(ndays_max);
+        ParallelDescriptor::ReduceRealSum(ndays_avg);
+        ParallelDescriptor::ReduceRealMin(wt_min);
+        ParallelDescriptor::ReduceRealMax(wt_max);
+        ParallelDescriptor::ReduceRealSum(wt_avg);
+        ndays_avg /= ParallelDescriptor::NProcs();
+        wt_avg    /= ParallelDescriptor::NProcs();
+
+        Print() << "Shortwave radiation at level " << lev << ", time " << time
+                << ": daylit columns per rank min/avg/max = "
+                << ndays_min << " / " << ndays_avg << " / " << ndays_max
+                << ", wall time per rank min/avg/max = "
+                << wt_min << " / " << wt_avg << " / " << wt_max << " s"
+                << ", imbalance (max/avg) = " << ((wt_avg > 0.0) ? wt_max/wt_avg : 1.0) << std::endl;
+    }
+
+    // Validation of coarse-column radiation: repeat the call on every column
+    // and compare the horizontally averaged heating-rate profiles
+    if (rad_full[lev]) {
+        BL_PROFILE("ERF::advance_radiation::coarsen_check");
+
+        MultiFab q_full(grids[lev], dmap[lev], 2, 0);
+        rad_full[lev]->initialize(cons,
+                                  nullptr,
+                                  nullptr,
+                                  &q_full,
+                                  lat_m[lev].get(),
+                                  lon_m[lev].get(),
+                                  qmoist[lev],
+                                  grids[lev],
+                                  Geom(lev),
+                                  dt_advance,
+                                  do_sw_rad,
+                                  do_lw_rad,
+                                  do_aero_rad,
+                                  do_snow_opt,
+                                  is_cmip6_volcano);
+        rad_full[lev]->run();
+
+        const Box& domain = Geom(lev).Domain();
+        const Real area = static_cast<Real>(grids[lev].numPts() / domain.length(2));
+
+        MultiFab q_diff(grids[lev], dmap[lev], 2, 0);
+        MultiFab::Copy(q_diff, *qheating_rates[lev], 0, 0, 2, 0);
+        MultiFab::Subtract(q_diff, q_full, 0, 0, 2, 0);
+
+        const char* names[2] = {"SW", "LW"};
+        for (int n = 0; n < 2; ++n) {
+            Gpu::HostVector<Real> prof_c = sumToLine(*qheating_rates[lev], n, 1, domain, 2);
+            Gpu::HostVector<Real> prof_f = sumToLine(q_full, n, 1, domain, 2);
+
+            Real max_prof_diff = 0.0;
+            Real max_prof_full = 0.0;
+            for (int k = 0; k < static_cast<int>(prof_f.size()); ++k) {
+                max_prof_diff = amrex::max(max_prof_diff, std::abs(prof_c[k] - prof_f[k]) / area);
+                max_prof_full = amrex::max(max_prof_full, std::abs(prof_f[k]) / area);
+            }
+            const Real max_point_diff = q_diff.norm0(n);
+
+            Print() << "Radiation coarsening check at level " << lev << ", time " << time << ": "
+                    << names[n] << " max |profile diff| = " << max_prof_diff
+                    << " (max |profile| = " << max_prof_full << ")"
+                    << ", max |pointwise diff| = " << max_point_diff << " K/s" << std::endl;
+        }
+    }
+
+    if (rad_extrapolate) {
+        std::swap(qheating_rates_last[lev], qheating_rates_prev[lev]);
+        MultiFab::Copy(*qheating_rates_last[lev], *qheating_rates[lev], 0, 0, 2, 0);
+    }
+
+    rad_time_prev[lev] = rad_time_last[lev];
+    rad_time_last[lev] = time;
+    ++rad_ncalls[lev];
 }
 #endif
@@ -41,6 +41,8 @@ using namespace amrex;
  * @param[in   ]  l_use_moisture
  * @param[in   ]  l_reflux should we add fluxes to the FluxRegisters?
  * @param[in   ]  l_implicit_substepping
+ * @param[in   ]  l_tridiag_solver which algorithm to use for the vertical tridiagonal solve
+ * @param[inout]  cost per-box kernel wall time for load balancing (may be null)
  */
 
 void erf_fast_rhs_MT (int step, int nrk,
@@ -74,7 +76,9 @@ void erf_fast_rhs_MT (int step, int nrk,
                       YAFluxRegister* fr_as_fine,
                       bool l_use_moisture,
                       bool l_reflux,
-                      bool /*l_implicit_substepping*/)
+                      bool /*l_implicit_substepping*/,
+                      TridiagSolverType l_tridiag_solver,
+                      LayoutData<Real>* cost)
 {
     BL_PROFILE_REGION("erf_fast_rhs_MT()");
 
@@ -122,6 +126,8 @@ void erf_fast_rhs_MT (int step, int nrk,
     //        will require additional changes
     for ( MFIter mfi(S_stg_data[IntVars::cons],false); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box bx  = mfi.tilebox();
         Box tbx = surroundingNodes(bx,0);
         Box tby = surroundingNodes(bx,1);
@@ -462,72 +468,23 @@ void erf_fast_rhs_MT (int step, int nrk,
         {
         BL_PROFILE("fast_rhs_b2d_loop_t");
 
-#ifdef AMREX_USE_GPU
         ParallelFor(b2d, [=] AMREX_GPU_DEVICE (int i, int j, int)
         {
             // Moving terrain
             Real rho_on_bdy = 0.5 * ( prev_cons(i,j,lo.z) + prev_cons(i,j,lo.z-1) );
-            RHS_a(i,j,lo.z) = rho_on_bdy * zp_t_arr(i,j,0);
-
-            soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
+            RHS_a(i,j,lo.z) = rho_on_bdy * zp_t_arr(i,j,lo.z);
 
             // w_khi = 0
-            RHS_a(i,j,hi.z+1)     =  0.0;
-
-            for (int k = lo.z+1; k <= hi.z+1; k++) {
-                soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-            }
-
-            for (int k = hi.z; k >= lo.z; k--) {
-                soln_a(i,j,k) -= ( coeffC_a(i,j,k) * inv_coeffB_a(i,j,k) ) * soln_a(i,j,k+1);
-            }
-
-           // We assume that Omega == w at the top boundary and that changes in J there are irrelevant
-            cur_zmom(i,j,hi.z+1) = stg_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
+            RHS_a(i,j,hi.z+1) =  0.0;
         });
-#else
-        for (int j = lo.y; j <= hi.y; ++j) {
-             AMREX_PRAGMA_SIMD
-             for (int i = lo.x; i <= hi.x; ++i) {
-
-                 Real rho_on_bdy = 0.5 * ( prev_cons(i,j,lo.z) + prev_cons(i,j,lo.z-1) );
-                 RHS_a(i,j,lo.z) = rho_on_bdy * zp_t_arr(i,j,lo.z);
-
-                 soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
-             }
-        }
 
-        for (int j = lo.y; j <= hi.y; ++j) {
-             AMREX_PRAGMA_SIMD
-             for (int i = lo.x; i <= hi.x; ++i) {
-                 RHS_a (i,j,hi.z+1) =  0.0;
-             }
-        }
-        for (int k = lo.z+1; k <= hi.z+1; ++k) {
-             for (int j = lo.y; j <= hi.y; ++j) {
-                 AMREX_PRAGMA_SIMD
-                 for (int i = lo.x; i <= hi.x; ++i) {
-                     soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-                 }
-           }
-        }
-        for (int k = hi.z; k >= lo.z; --k) {
-             for (int j = lo.y; j <= hi.y; ++j) {
-                 AMREX_PRAGMA_SIMD
-                 for (int i = lo.x; i <= hi.x; ++i) {
-                     soln_a(i,j,k) -= ( coeffC_a(i,j,k) * inv_coeffB_a(i,j,k) ) * soln_a(i,j,k+1);
-                 }
-             }
-        }
+        solve_fast_tridiag(bx, coeffA_a, inv_coeffB_a, coeffC_a, RHS_a, soln_a, l_tridiag_solver);
 
         // We assume that Omega == w at the top boundary and that changes in J there are irrelevant
-        for (int j = lo.y; j <= hi.y; ++j) {
-             AMREX_PRAGMA_SIMD
-             for (int i = lo.x; i <= hi.x; ++i) {
-                cur_zmom(i,j,hi.z+1) = stg_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
-            }
-        }
-#endif
+        ParallelFor(b2d, [=] AMREX_GPU_DEVICE (int i, int j, int)
+        {
+            cur_zmom(i,j,hi.z+1) = stg_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
+        });
         } // end profile
 
         {
@@ -626,6 +583,7 @@ void erf_fast_rhs_MT (int step, int nrk,
 
         } // two-way coupling
 
+        box_cost_stop(cost, mfi, wt);
     } // mfi
     } // OMP
 }
@@ -31,6 +31,8 @@ using namespace amrex;
  * @param[in   ]  l_use_moisture
  * @param[in   ]  l_reflux should we add fluxes to the FluxRegisters?
  * @param[in   ]  l_implicit_substepping
+ * @param[in   ]  l_tridiag_solver which algorithm to use for the vertical tridiagonal solve
+ * @param[inout]  cost per-box kernel wall time for load balancing (may be null)
  */
 
 void erf_fast_rhs_N (int step, int nrk,
@@ -54,7 +56,9 @@ void erf_fast_rhs_N (int step, int nrk,
                      YAFluxRegister* fr_as_fine,
                      bool l_use_moisture,
                      bool l_reflux,
-                     bool l_implicit_substepping)
+                     bool l_implicit_substepping,
+                     TridiagSolverType l_tridiag_solver,
+                     LayoutData<Real>* cost)
 {
     //
     // NOTE: for step > 0, S_data and S_prev point to the same MultiFab data!!
@@ -114,6 +118,8 @@ void erf_fast_rhs_N (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         const Array4<const Real>& prev_cons  = S_prev[IntVars::cons].const_array(mfi);
         const Array4<const Real>& prev_zmom =  S_prev[IntVars::zmom].const_array(mfi);
 
@@ -149,6 +155,7 @@ void erf_fast_rhs_N (int step, int nrk,
         ParallelFor(gtbz, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept {
             prev_drho_w(i,j,k) = prev_zmom(i,j,k) - stage_zmom(i,j,k);
         });
+        box_cost_stop(cost, mfi, wt);
     } // mfi
 
     // *************************************************************************
@@ -160,6 +167,8 @@ void erf_fast_rhs_N (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box tbx = mfi.nodaltilebox(0);
         Box tby = mfi.nodaltilebox(1);
 
@@ -254,6 +263,7 @@ void erf_fast_rhs_N (int step, int nrk,
                 temp_cur_ymom_arr(i,j,k) = stage_ymom(i,j,k) + new_drho_v;
             });
         } // nrk > 0 and/or step > 0
+        box_cost_stop(cost, mfi, wt);
     } //mfi
 
 #ifdef _OPENMP
@@ -263,6 +273,8 @@ void erf_fast_rhs_N (int step, int nrk,
     std::array<FArrayBox,AMREX_SPACEDIM> flux;
     for ( MFIter mfi(S_stage_data[IntVars::cons],TileNoZ()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box bx  = mfi.tilebox();
         Box tbz = surroundingNodes(bx,2);
 
@@ -431,29 +443,18 @@ void erf_fast_rhs_N (int step, int nrk,
                              + dtau * slow_rhs_rho_w(i,j,hi.z+1);
         }); // b2d
 
-#ifdef AMREX_USE_GPU
         if (l_implicit_substepping) {
 
-            ParallelFor(b2d, [=] AMREX_GPU_DEVICE (int i, int j, int)
-            {
-              // w = specified Dirichlet value at k = lo.z
-                soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
-              cur_zmom(i,j,lo.z) = stage_zmom(i,j,lo.z) + soln_a(i,j,lo.z);
+            solve_fast_tridiag(bx, coeffA_a, inv_coeffB_a, coeffC_a, RHS_a, soln_a, l_tridiag_solver);
 
-              for (int k = lo.z+1; k <= hi.z+1; k++) {
-                  soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-              }
-
-              cur_zmom(i,j,hi.z+1) = stage_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
-
-              for (int k = hi.z; k >= lo.z; k--) {
-                  soln_a(i,j,k) -= ( coeffC_a(i,j,k) * inv_coeffB_a(i,j,k) ) *soln_a(i,j,k+1);
-                  cur_zmom(i,j,k) = stage_zmom(i,j,k) + soln_a(i,j,k);
-              }
-            }); // b2d
+            ParallelFor(tbz, [=] AMREX_GPU_DEVICE (int i, int j, int k)
+            {
+                cur_zmom(i,j,k) = stage_zmom(i,j,k) + soln_a(i,j,k);
+            });
 
         } else { // explicit substepping (beta_1 = 1; beta_2 = 0)
 
+#ifdef AMREX_USE_GPU
             ParallelFor(b2d, [=] AMREX_GPU_DEVICE (int i, int j, int)
             {
               for (int k = lo.z; k <= hi.z+1; k++) {
@@ -461,41 +462,7 @@ void erf_fast_rhs_N (int step, int nrk,
                   cur_zmom(i,j,k) = stage_zmom(i,j,k) + soln_a(i,j,k);
               }
             }); // b2d
-        } // end of explicit substepping
 #else
-        if (l_implicit_substepping) {
-
-            for (int j = lo.y; j <= hi.y; ++j) {
-                AMREX_PRAGMA_SIMD
-                for (int i = lo.x; i <= hi.x; ++i) {
-                    soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
-                }
-            }
-            for (int k = lo.z+1; k <= hi.z+1; ++k) {
-                for (int j = lo.y; j <= hi.y; ++j) {
-                    AMREX_PRAGMA_SIMD
-                    for (int i = lo.x; i <= hi.x; ++i) {
-                        soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-                    }
-                }
-            }
-            for (int j = lo.y; j <= hi.y; ++j) {
-                AMREX_PRAGMA_SIMD
-                for (int i = lo.x; i <= hi.x; ++i) {
-                    cur_zmom(i,j,hi.z+1) = stage_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
-                }
-            }
-            for (int k = hi.z; k >= lo.z; --k) {
-                for (int j = lo.y; j <= hi.y; ++j) {
-                    AMREX_PRAGMA_SIMD
-                    for (int i = lo.x; i <= hi.x; ++i) {
-                        soln_a(i,j,k) -= ( coeffC_a(i,j,k) * inv_coeffB_a(i,j,k) ) * soln_a(i,j,k+1);
-                        cur_zmom(i,j,k) = stage_zmom(i,j,k) + soln_a(i,j,k);
-                    }
-                }
-            }
-        } else { // explicit substepping (beta_1 = 1; beta_2 = 0)
-
             for (int k = lo.z; k <= hi.z+1; ++k) {
                 for (int j = lo.y; j <= hi.y; ++j) {
                     AMREX_PRAGMA_SIMD
@@ -507,9 +474,8 @@ void erf_fast_rhs_N (int step, int nrk,
                     }
                 }
             }
-
-        } // end of explicit substepping
 #endif
+        } // end of explicit substepping
 
         // **************************************************************************
         // Define updates in the RHS of rho and (rho theta)
@@ -557,6 +523,7 @@ void erf_fast_rhs_N (int step, int nrk,
             Gpu::streamSynchronize();
 
         } // two-way coupling
+        box_cost_stop(cost, mfi, wt);
     } // mfi
     } // OMP
 
@@ -565,6 +532,8 @@ void erf_fast_rhs_N (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         const Box& bx = mfi.tilebox();
 
         const Array4<      Real>&  cur_cons = S_data[IntVars::cons].array(mfi);
@@ -610,5 +579,6 @@ void erf_fast_rhs_N (int step, int nrk,
             cur_ymom(i,j,k) = temp_cur_ymom_arr(i,j,k);
         });
 
+        box_cost_stop(cost, mfi, wt);
     } // mfi
 }
@@ -34,6 +34,8 @@ using namespace amrex;
  * @param[in   ] l_use_moisture
  * @param[in   ] l_reflux should we add fluxes to the FluxRegisters?
  * @param[in   ] l_implicit_substepping
+ * @param[in   ] l_tridiag_solver which algorithm to use for the vertical tridiagonal solve
+ * @param[inout] cost per-box kernel wall time for load balancing (may be null)
  */
 
 void erf_fast_rhs_T (int step, int nrk,
@@ -60,7 +62,9 @@ void erf_fast_rhs_T (int step, int nrk,
                      YAFluxRegister* fr_as_fine,
                      bool l_use_moisture,
                      bool l_reflux,
-                     bool /*l_implicit_substepping*/)
+                     bool /*l_implicit_substepping*/,
+                     TridiagSolverType l_tridiag_solver,
+                     LayoutData<Real>* cost)
 {
     BL_PROFILE_REGION("erf_fast_rhs_T()");
 
@@ -114,6 +118,8 @@ void erf_fast_rhs_T (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         const Array4<Real>       & cur_cons  = S_data[IntVars::cons].array(mfi);
         const Array4<const Real>& prev_cons  = S_prev[IntVars::cons].const_array(mfi);
         const Array4<const Real>& stage_cons = S_stage_data[IntVars::cons].const_array(mfi);
@@ -183,6 +189,7 @@ void erf_fast_rhs_T (int step, int nrk,
                   ( old_drho_theta(i,j,k) - lagged_delta_rt(i,j,k,RhoTheta_comp) );
             }
         });
+        box_cost_stop(cost, mfi, wt);
     } // mfi
 
 #ifdef _OPENMP
@@ -190,6 +197,8 @@ void erf_fast_rhs_T (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         // We define lagged_delta_rt for our next step as the current delta_rt
         Box gbx = mfi.tilebox(); gbx.grow(1);
         const Array4<Real>& old_drho_theta  = Delta_rho_theta.array(mfi);
@@ -197,6 +206,7 @@ void erf_fast_rhs_T (int step, int nrk,
         ParallelFor(gbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept {
             lagged_delta_rt(i,j,k,RhoTheta_comp) = old_drho_theta(i,j,k);
         });
+        box_cost_stop(cost, mfi, wt);
     } // mfi
 
     // *************************************************************************
@@ -208,6 +218,8 @@ void erf_fast_rhs_T (int step, int nrk,
 #endif
     for ( MFIter mfi(S_stage_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box  bx = mfi.validbox();
         Box tbx = mfi.nodaltilebox(0);
         Box tby = mfi.nodaltilebox(1);
@@ -330,6 +342,7 @@ void erf_fast_rhs_T (int step, int nrk,
                 cur_ymom(i,j,k) = stage_ymom(i,j,k) + new_drho_v(i,j,k);
         });
         } // end profile
+        box_cost_stop(cost, mfi, wt);
     }
 
 #ifdef _OPENMP
@@ -339,6 +352,8 @@ void erf_fast_rhs_T (int step, int nrk,
     std::array<FArrayBox,AMREX_SPACEDIM> flux;
     for ( MFIter mfi(S_stage_data[IntVars::cons],TileNoZ()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box bx  = mfi.tilebox();
         Box tbz = surroundingNodes(bx,2);
 
@@ -560,69 +575,14 @@ void erf_fast_rhs_T (int step, int nrk,
 
         {
         BL_PROFILE("fast_rhs_b2d_loop_t");
-#ifdef AMREX_USE_GPU
         ParallelFor(b2d, [=] AMREX_GPU_DEVICE (int i, int j, int)
         {
             // w_klo, w_khi given by specified Dirichlet values
             RHS_a(i,j,lo.z  ) = dtau * slow_rhs_rho_w(i,j,lo.z);
             RHS_a(i,j,hi.z+1) = dtau * slow_rhs_rho_w(i,j,hi.z+1);
-
-            // w = specified Dirichlet value at k = lo.z
-            soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
-
-            for (int k = lo.z+1; k <= hi.z+1; k++) {
-                soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-            }
-
-            cur_zmom(i,j,lo.z  ) = stage_zmom(i,j,lo.z  ) + soln_a(i,j,lo.z  );
-            cur_zmom(i,j,hi.z+1) = stage_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
-
-            for (int k = hi.z; k >= lo.z; k--) {
-                soln_a(i,j,k) -= ( coeffC_a(i,j,k) * inv_coeffB_a(i,j,k) ) *soln_a(i,j,k+1);
-            }
         });
-#else
-        for (int j = lo.y; j <= hi.y; ++j) {
-            AMREX_PRAGMA_SIMD
-            for (int i = lo.x; i <= hi.x; ++i)
-            {
-                RHS_a(i,j,lo.z) = dtau * slow_rhs_rho_w(i,j,lo.z);
-               soln_a(i,j,lo.z) = RHS_a(i,j,lo.z) * inv_coeffB_a(i,j,lo.z);
-            }
 
-            AMREX_PRAGMA_SIMD
-            for (int i = lo.x; i <= hi.x; ++i)
-            {
-                RHS_a(i,j,hi.z+1) = dtau * slow_rhs_rho_w(i,j,hi.z+1);
-               soln_a(i,j,hi.z+1) = RHS_a(i,j,hi.z+1) * inv_coeffB_a(i,j,hi.z+1);
-            }
-        }
-
-        for (int k = lo.z+1; k <= hi.z; ++k) {
-             for (int j = lo.y; j <= hi.y; ++j) {
-                 AMREX_PRAGMA_SIMD
-                 for (int i = lo.x; i <= hi.x; ++i) {
-                     soln_a(i,j,k) = (RHS_a(i,j,k)-coeffA_a(i,j,k)*soln_a(i,j,k-1)) * inv_coeffB_a(i,j,k);
-                 }
-           }
-        }
-        for (int k = hi.z; k > lo.z; --k) {
-             for (int j = lo.y; j <= hi.y; ++j) {
-                 AMREX_PRAGMA_SIMD
-                 for (int i = lo.x; i <= hi.x; ++i) {
-                     soln_a(i,j,k) -= (coeffC_a(i,j,k) * inv_coeffB_a(i,j,k)) * soln_a(i,j,k+1);
-                 }
-             }
-        }
-        if (hi.z == domhi.z) {
-            for (int j = lo.y; j <= hi.y; ++j) {
-                 AMREX_PRAGMA_SIMD
-                 for (int i = lo.x; i <= hi.x; ++i) {
-                    cur_zmom(i,j,hi.z+1) = stage_zmom(i,j,hi.z+1) + soln_a(i,j,hi.z+1);
-                }
-            }
-        }
-#endif
+        solve_fast_tridiag(bx, coeffA_a, inv_coeffB_a, coeffC_a, RHS_a, soln_a, l_tridiag_solver);
         } // end profile
 
         ParallelFor(tbz, [=] AMREX_GPU_DEVICE (int i, int j, int k)
@@ -699,6 +659,7 @@ void erf_fast_rhs_T (int step, int nrk,
             Gpu::streamSynchronize();
 
         } // two-way coupling
+        box_cost_stop(cost, mfi, wt);
     } // mfi
     } // OMP
 }
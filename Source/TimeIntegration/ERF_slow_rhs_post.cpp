@@ -39,11 +39,13 @@ using namespace amrex;
  * @param[in] az area fractions on z-faces
  * @param[in] detJ     Jacobian of the metric transformation at start of time step (= 1 if use_terrain is false)
  * @param[in] detJ_new Jacobian of the metric transformation at new RK stage time (= 1 if use_terrain is false)
+ * @param[in] face_metrics precomputed face metric terms (nullptr unless erf.cache_terrain_metrics)
  * @param[in] mapfac_m map factor at cell centers
  * @param[in] mapfac_u map factor at x-faces
  * @param[in] mapfac_v map factor at y-faces
  * @param[inout] fr_as_crse YAFluxRegister at level l at level l   / l+1 interface
  * @param[inout] fr_as_fine YAFluxRegister at level l at level l-1 / l   interface
+ * @param[inout] cost per-box kernel wall time for load balancing (may be null)
  */
 
 void erf_slow_rhs_post (int level, int finest_level,
@@ -81,6 +83,7 @@ void erf_slow_rhs_post (int level, int finest_level,
                         std::unique_ptr<MultiFab>& az,
                         std::unique_ptr<MultiFab>& detJ,
                         std::unique_ptr<MultiFab>& detJ_new,
+                        const MultiFab* face_metrics,
                         std::unique_ptr<MultiFab>& mapfac_m,
                         std::unique_ptr<MultiFab>& mapfac_u,
                         std::unique_ptr<MultiFab>& mapfac_v,
@@ -100,7 +103,8 @@ void erf_slow_rhs_post (int level, int finest_level,
                         Vector<Vector<FArrayBox>>& bdy_data_yhi,
 #endif
                         YAFluxRegister* fr_as_crse,
-                        YAFluxRegister* fr_as_fine)
+                        YAFluxRegister* fr_as_fine,
+                        LayoutData<Real>* cost)
 {
     BL_PROFILE_REGION("erf_slow_rhs_post()");
 
@@ -226,6 +230,7 @@ void erf_slow_rhs_post (int level, int finest_level,
       int   num_comp;
 
       for ( MFIter mfi(S_data[IntVars::cons],TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(cost);
 
         Box tbx  = mfi.tilebox();
 
@@ -274,6 +279,7 @@ void erf_slow_rhs_post (int level, int finest_level,
         const Array4<Real const>& mu_turb = l_use_turb ? eddyDiffs->const_array(mfi) : Array4<const Real>{};
 
         const Array4<const Real>& z_nd         = l_use_terrain    ? z_phys_nd->const_array(mfi) : Array4<const Real>{};
+        const Array4<const Real>& face_met     = face_metrics     ? face_metrics->const_array(mfi) : Array4<const Real>{};
         const Array4<const Real>& detJ_new_arr = l_moving_terrain ? detJ_new->const_array(mfi)    : Array4<const Real>{};
 
         // Map factors
@@ -415,7 +421,7 @@ void erf_slow_rhs_post (int level, int finest_level,
                         DiffusionSrcForState_T(tbx, domain, start_comp, num_comp, exp_most, rot_most, u, v,
                                                new_cons, cur_prim, cell_rhs,
                                                diffflux_x, diffflux_y, diffflux_z,
-                                               z_nd, ax_arr, ay_arr, az_arr, detJ_arr,
+                                               z_nd, face_met, ax_arr, ay_arr, az_arr, detJ_arr,
                                                dxInv, SmnSmn_a, mf_m, mf_u, mf_v,
                                                hfx_x, hfx_y, hfx_z, q1fx_x, q1fx_y, q1fx_z,q2fx_z, diss,
                                                mu_turb, solverChoice, level,
@@ -554,6 +560,7 @@ void erf_slow_rhs_post (int level, int finest_level,
 
         } // two-way coupling
         } // end profile
+        box_cost_stop(cost, mfi, wt);
       } // mfi
     } // OMP
 }
@@ -55,6 +55,7 @@ using namespace amrex;
  * @param[in] ay area fractions on y-faces
  * @param[in] az area fractions on z-faces
  * @param[in] detJ Jacobian of the metric transformation (= 1 if use_terrain is false)
+ * @param[in] face_metrics precomputed face metric terms (nullptr unless erf.cache_terrain_metrics)
  * @param[in]  p0     Reference (hydrostatically stratified) pressure
  * @param[in] pp_inc  Perturbational pressure only used for anelastic flow
  * @param[in] mapfac_m map factor at cell centers
@@ -62,6 +63,7 @@ using namespace amrex;
  * @param[in] mapfac_v map factor at y-faces
  * @param[inout] fr_as_crse YAFluxRegister at level l at level l   / l+1 interface
  * @param[inout] fr_as_fine YAFluxRegister at level l at level l-1 / l   interface
+ * @param[inout] cost per-box kernel wall time for load balancing (may be null)
  */
 
 void erf_slow_rhs_pre (int level, int finest_level,
@@ -104,6 +106,7 @@ void erf_slow_rhs_pre (int level, int finest_level,
                        std::unique_ptr<MultiFab>& ay,
                        std::unique_ptr<MultiFab>& az,
                        std::unique_ptr<MultiFab>& detJ,
+                       const MultiFab* face_metrics,
                        const MultiFab* p0,
 #ifdef ERF_USE_POISSON_SOLVE
                        const MultiFab& pp_inc,
@@ -115,7 +118,8 @@ void erf_slow_rhs_pre (int level, int finest_level,
                        EBFArrayBoxFactory const& ebfact,
 #endif
                        YAFluxRegister* fr_as_crse,
-                       YAFluxRegister* fr_as_fine)
+                       YAFluxRegister* fr_as_fine,
+                       LayoutData<Real>* cost)
 {
     BL_PROFILE_REGION("erf_slow_rhs_pre()");
 
@@ -166,6 +170,23 @@ void erf_slow_rhs_pre (int level, int finest_level,
     // We cannot use anelastic with terrain or with moisture
     AMREX_ALWAYS_ASSERT(!l_use_terrain  || !l_anelastic);
 
+    // Without terrain, with unit map factors and with second-order advection of rho and (rho theta)
+    //    we can build their advective tendencies and add the sources in a single sweep.
+    //    Counting 3D array accesses per cell, this takes rho and (rho theta) from 37 to 23
+    //    (296 to 184 bytes in double precision). Diffusion and the momentum RHS are not fused.
+    const bool l_any_open_bc = ( (bc_ptr_h[BCVars::cons_bc].lo(0) == ERFBCType::open) ||
+                                 (bc_ptr_h[BCVars::cons_bc].hi(0) == ERFBCType::open) ||
+                                 (bc_ptr_h[BCVars::cons_bc].lo(1) == ERFBCType::open) ||
+                                 (bc_ptr_h[BCVars::cons_bc].hi(1) == ERFBCType::open) );
+#ifdef ERF_USE_EB
+    const bool l_fused_rhs = false;
+    amrex::ignore_unused(l_any_open_bc);
+#else
+    const bool l_fused_rhs = ( !l_use_terrain && !solverChoice.test_mapfactor && !l_use_mono_adv && !l_any_open_bc &&
+                               (l_horiz_adv_type == AdvType::Centered_2nd) &&
+                               (l_vert_adv_type  == AdvType::Centered_2nd) );
+#endif
+
     const Box& domain = geom.Domain();
     const int domhi_z = domain.bigEnd(2);
 
@@ -243,6 +264,8 @@ void erf_slow_rhs_pre (int level, int finest_level,
 
     for ( MFIter mfi(S_data[IntVars::cons],TileNoZ()); mfi.isValid(); ++mfi)
     {
+        Real wt = box_cost_start(cost);
+
         Box bx  = mfi.tilebox();
         Box tbx = mfi.nodaltilebox(0);
         Box tby = mfi.nodaltilebox(1);
@@ -309,6 +332,7 @@ void erf_slow_rhs_pre (int level, int finest_level,
 
         // Terrain metrics
         const Array4<const Real>& z_nd     = l_use_terrain ? z_phys_nd->const_array(mfi) : Array4<const Real>{};
+        const Array4<const Real>& face_met = face_metrics  ? face_metrics->const_array(mfi) : Array4<const Real>{};
 
         // Base state
         const Array4<const Real>& p0_arr = p0->const_array(mfi);
@@ -459,22 +483,32 @@ void erf_slow_rhs_pre (int level, int finest_level,
         auto const& detJ_arr = detJ->const_array(mfi);
 #endif
 
-        AdvectionSrcForRho(bx, cell_rhs,
-                           rho_u, rho_v, omega_arr,      // these are being used to build the fluxes
-                           avg_xmom, avg_ymom, avg_zmom, // these are being defined from the fluxes
-                           ax_arr, ay_arr, az_arr, detJ_arr,
-                           dxInv, mf_m, mf_u, mf_v,
-                           flx_arr, l_const_rho);
-
-        int icomp = RhoTheta_comp; int ncomp = 1;
-        AdvectionSrcForScalars(dt, bx, icomp, ncomp,
-                               avg_xmom, avg_ymom, avg_zmom,
-                               cell_data, cell_prim, cell_rhs,
-                               l_use_mono_adv, max_s_ptr, min_s_ptr,
-                               detJ_arr, dxInv, mf_m,
-                               l_horiz_adv_type, l_vert_adv_type,
-                               l_horiz_upw_frac, l_vert_upw_frac,
-                               flx_arr, flx_tmp_arr, domain, bc_ptr_h);
+        const Array4<Real const>& source_arr   = cc_src.const_array(mfi);
+
+        if (l_fused_rhs) {
+            // This also adds the sources for rho and (rho theta)
+            AdvectionSrcForRhoThetaFused_N(bx, cell_rhs,
+                                           rho_u, rho_v, rho_w, cell_prim, source_arr,
+                                           avg_xmom, avg_ymom, avg_zmom,
+                                           dxInv, flx_arr, l_const_rho);
+        } else {
+            AdvectionSrcForRho(bx, cell_rhs,
+                               rho_u, rho_v, omega_arr,      // these are being used to build the fluxes
+                               avg_xmom, avg_ymom, avg_zmom, // these are being defined from the fluxes
+                               ax_arr, ay_arr, az_arr, detJ_arr,
+                               dxInv, mf_m, mf_u, mf_v,
+                               flx_arr, l_const_rho);
+
+            int icomp = RhoTheta_comp; int ncomp = 1;
+            AdvectionSrcForScalars(dt, bx, icomp, ncomp,
+                                   avg_xmom, avg_ymom, avg_zmom,
+                                   cell_data, cell_prim, cell_rhs,
+                                   l_use_mono_adv, max_s_ptr, min_s_ptr,
+                                   detJ_arr, dxInv, mf_m,
+                                   l_horiz_adv_type, l_vert_adv_type,
+                                   l_horiz_upw_frac, l_vert_upw_frac,
+                                   flx_arr, flx_tmp_arr, domain, bc_ptr_h);
+        }
 
         if (l_use_diff) {
             Array4<Real> diffflux_x = dflux_x->array(mfi);
@@ -502,7 +536,7 @@ void erf_slow_rhs_pre (int level, int finest_level,
                 DiffusionSrcForState_T(bx, domain, n_start, n_comp, l_exp_most, l_rot_most, u, v,
                                        cell_data, cell_prim, cell_rhs,
                                        diffflux_x, diffflux_y, diffflux_z,
-                                       z_nd, ax_arr, ay_arr, az_arr, detJ_arr,
+                                       z_nd, face_met, ax_arr, ay_arr, az_arr, detJ_arr,
                                        dxInv, SmnSmn_a, mf_m, mf_u, mf_v,
                                        hfx_x, hfx_y, hfx_z, q1fx_x, q1fx_y, q1fx_z, q2fx_z, diss,
                                        mu_turb, solverChoice, level,
@@ -518,12 +552,13 @@ void erf_slow_rhs_pre (int level, int finest_level,
             }
         }
 
-        const Array4<Real const>& source_arr   = cc_src.const_array(mfi);
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-        {
-            cell_rhs(i,j,k,Rho_comp)      += source_arr(i,j,k,Rho_comp);
-            cell_rhs(i,j,k,RhoTheta_comp) += source_arr(i,j,k,RhoTheta_comp);
-        });
+        if (!l_fused_rhs) {
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                cell_rhs(i,j,k,Rho_comp)      += source_arr(i,j,k,Rho_comp);
+                cell_rhs(i,j,k,RhoTheta_comp) += source_arr(i,j,k,RhoTheta_comp);
+            });
+        }
 
         // Multiply the slow RHS for rho and rhotheta by detJ here so we don't have to later
         if (l_use_terrain && l_moving_terrain) {
@@ -769,6 +804,7 @@ void erf_slow_rhs_pre (int level, int finest_level,
 
         } // two-way coupling
         } // end profile
+        box_cost_stop(cost, mfi, wt);
     } // mfi
     } // OMP
 }
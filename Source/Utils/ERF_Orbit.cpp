@@ -7,6 +7,7 @@ zenith (int& calday,
         amrex::MultiFab* clat,
         amrex::MultiFab* clon,
         const amrex::Vector<int> &rank_offsets,
+        int coarsen,
         real1d& coszrs,
         int& ncol,
         const Real& eccen,
@@ -24,19 +25,24 @@ zenith (int& calday,
     // If we have a valid pointer, go through the whole machinery
     if (clat) {
         for (MFIter mfi(*clat); mfi.isValid(); ++mfi) {
-            const auto& tbx = mfi.tilebox();
-            auto nx = tbx.length(0);
+            const RadColumnMap cmap(mfi.validbox(), coarsen, rank_offsets[mfi.LocalIndex()]);
 
             auto lat_array = clat->array(mfi);
             auto lon_array = clon->array(mfi);
 
-            const int offset = rank_offsets[mfi.LocalIndex()];
-
             // NOTE: lat/lon are 2D multifabs!
-            ParallelFor(tbx, [=] AMREX_GPU_DEVICE (int i, int j, int /*k*/)
+            // Coarsened columns use the mean cosine over their cells
+            ParallelFor(cmap.columns(), [=] AMREX_GPU_DEVICE (int ic, int jc, int /*k*/)
             {
-                auto icol = (j-tbx.smallEnd(1))*nx + (i-tbx.smallEnd(0)) + 1 + offset;
-                coszrs(icol) = shr_orb_cosz(calday, lat_array(i,j,0), lon_array(i,j,0), delta, uniform_angle);
+                int i0, i1, j0, j1;
+                cmap.cells(ic, jc, i0, i1, j0, j1);
+                Real sum = 0.0;
+                for (int j = j0; j <= j1; ++j) {
+                    for (int i = i0; i <= i1; ++i) {
+                        sum += shr_orb_cosz(calday, lat_array(i,j,0), lon_array(i,j,0), delta, uniform_angle);
+                    }
+                }
+                coszrs(cmap.column(ic,jc)) = sum / Real((i1-i0+1)*(j1-j0+1));
             });
        }
     }
@@ -680,6 +680,52 @@ make_areas (const Geometry& geom,
     az.FillBoundary(geom.periodicity());
 }
 
+/**
+ * Computation of the face metric cache used by the terrain diffusion operator
+ * (see FaceMetric and TerrainFaceMetrics in ERF_TerrainMetrics.H). The ghost cells
+ * are filled directly from z_phys_nd so the high faces of every tile are available.
+ */
+void
+make_face_metrics (const Geometry& geom,
+                   MultiFab& z_phys_nd,
+                   MultiFab& face_metrics)
+{
+    BL_PROFILE("make_face_metrics()");
+
+    AMREX_ALWAYS_ASSERT(face_metrics.nComp() == FaceMetric::NumComps);
+
+    auto cellSizeInv = geom.InvCellSizeArray();
+
+    // Domain valid box (z_nd is nodal)
+    const Box& domain = geom.Domain();
+    int domlo_z = domain.smallEnd(2);
+
+    // Number of ghost cells
+    int ngrow = face_metrics.nGrow();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for ( MFIter mfi(face_metrics, TilingIfNotGPU()); mfi.isValid(); ++mfi )
+    {
+        Box gbx = mfi.growntilebox(ngrow);
+        if (gbx.smallEnd(2) < domlo_z) {
+            gbx.setSmall(2,domlo_z);
+        }
+        Array4<Real const> z_nd = z_phys_nd.const_array(mfi);
+        Array4<Real      > met  = face_metrics.array(mfi);
+        ParallelFor(gbx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            met(i,j,k,FaceMetric::xi_I  ) = Compute_h_xi_AtIface  (i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::zeta_I) = Compute_h_zeta_AtIface(i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::eta_J ) = Compute_h_eta_AtJface (i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::zeta_J) = Compute_h_zeta_AtJface(i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::xi_K  ) = Compute_h_xi_AtKface  (i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::eta_K ) = Compute_h_eta_AtKface (i,j,k,cellSizeInv,z_nd);
+            met(i,j,k,FaceMetric::zeta_K) = Compute_h_zeta_AtKface(i,j,k,cellSizeInv,z_nd);
+        });
+    }
+}
+
 /**
  * Computation of z_phys at cell-center
  */
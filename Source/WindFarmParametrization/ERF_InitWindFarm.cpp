@@ -440,11 +440,18 @@ WindFarm::fill_SMark_multifab(const Geometry& geom,
     Real nx = -std::cos(theta);
     Real ny = -std::sin(theta);
 
+    // Number of cells that lie in more than one actuator disk
+    ReduceOps<ReduceOpSum> reduce_op;
+    ReduceData<Long> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+
      // Initialize wind farm
     for ( MFIter mfi(mf_SMark,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
         const Box& bx     = mfi.tilebox();
         auto  SMark_array = mf_SMark.array(mfi);
-        ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        reduce_op.eval(bx, reduce_data,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept -> ReduceTuple
+        {
             int ii = amrex::min(amrex::max(i, i_lo), i_hi);
             int jj = amrex::min(amrex::max(j, j_lo), j_hi);
             int kk = amrex::min(amrex::max(k, k_lo), k_hi);
@@ -456,6 +463,10 @@ WindFarm::fill_SMark_multifab(const Geometry& geom,
 
             Real z = ProbLoArr[2] + (kk+0.5) * dx[2];
 
+            // The actuator disk kernels look up the turbine index directly from SMark,
+            // so a cell in several disks only sees the last of them
+            int num_disks = 0;
+
             for(int it=0; it<num_turb; it++){
                 Real x0 = d_xloc_ptr[it] + d_sampling_distance*nx;
                 Real y0 = d_yloc_ptr[it] + d_sampling_distance*ny;
@@ -472,11 +483,21 @@ WindFarm::fill_SMark_multifab(const Geometry& geom,
                                                 nx, ny, d_hub_height, d_rotor_rad, z);
                 if(is_cell_marked) {
                     SMark_array(i,j,k,1) = it;
+                    num_disks++;
                 }
 
             }
+            return { (num_disks > 1) ? Long(1) : Long(0) };
         });
     }
+
+    Long num_overlap = amrex::get<0>(reduce_data.value(reduce_op));
+    ParallelDescriptor::ReduceLongSum(num_overlap, ParallelDescriptor::IOProcessorNumber());
+    if (ParallelDescriptor::IOProcessor() && num_overlap > 0) {
+        amrex::Warning("Actuator disks are overlapping in " + std::to_string(num_overlap) +
+                       " cells, which only get the source term of the last of these disks. "
+                       "Visualize actuator_disks_all.vtk and check the windturbine locations input file.");
+    }
 }
 
 void
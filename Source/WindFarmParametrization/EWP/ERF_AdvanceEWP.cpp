@@ -30,6 +30,7 @@ EWP::update (const Real& dt_advance,
 {
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         Box bx  = mfi.tilebox();
         Box tbx = mfi.nodaltilebox(0);
@@ -53,6 +54,7 @@ EWP::update (const Real& dt_advance,
         {
             cons_array(i,j,k,RhoQKE_comp) = cons_array(i,j,k,RhoQKE_comp) + ewp_array(i,j,k,2)*dt_advance;
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }
 
@@ -93,6 +95,7 @@ EWP::source_terms_cellcentered (const Geometry& geom,
   mf_vars_ewp.setVal(0.0);
 
   for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         const Box& gbx = mfi.growntilebox(1);
         auto ewp_array = mf_vars_ewp.array(mfi);
@@ -133,5 +136,6 @@ EWP::source_terms_cellcentered (const Geometry& geom,
             ewp_array(i,j,k,1) = fac*std::sin(phi)*Nturb_array(i,j,k);
             ewp_array(i,j,k,2) = C_TKE*0.0;
          });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }
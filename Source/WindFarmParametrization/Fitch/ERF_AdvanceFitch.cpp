@@ -70,6 +70,7 @@ Fitch::update (const Real& dt_advance,
 {
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         Box bx  = mfi.tilebox();
         Box tbx = mfi.nodaltilebox(0);
@@ -93,6 +94,7 @@ Fitch::update (const Real& dt_advance,
         {
             cons_array(i,j,k,RhoQKE_comp) = cons_array(i,j,k,RhoQKE_comp) + fitch_array(i,j,k,4)*dt_advance;
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }
 
@@ -132,6 +134,7 @@ Fitch::source_terms_cellcentered (const Geometry& geom,
   Gpu::copy(Gpu::hostToDevice, thrust_coeff.begin(), thrust_coeff.end(), d_thrust_coeff.begin());
 
   for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         const Box& gbx = mfi.growntilebox(1);
         auto fitch_array = mf_vars_fitch.array(mfi);
@@ -169,6 +172,7 @@ Fitch::source_terms_cellcentered (const Geometry& geom,
 
                  //amrex::Gpu::Atomic::Add(sum_area, A_ijk);
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
         //std::cout << "Checking sum here...." <<"\n";
         //printf("%0.15g, %0.15g\n", *sum_area , PI*R*R);
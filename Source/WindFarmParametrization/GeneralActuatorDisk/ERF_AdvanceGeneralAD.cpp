@@ -34,6 +34,7 @@ GeneralAD::update (const Real& dt_advance,
 {
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         Box tbx = mfi.nodaltilebox(0);
         Box tby = mfi.nodaltilebox(1);
@@ -57,8 +58,82 @@ GeneralAD::update (const Real& dt_advance,
         {
             w_vel(i,j,k) = w_vel(i,j,k) + (generalAD_array(i,j,k-1,2) + generalAD_array(i,j,k,2))/2.0*dt_advance;
         });
+        box_cost_stop(m_cost, mfi, wt);
+    }
+}
+
+void
+GeneralAD::set_turb_loc (const Vector<Real>& a_xloc,
+                         const Vector<Real>& a_yloc)
+{
+    NullWindFarm::set_turb_loc(a_xloc, a_yloc);
+
+    d_xloc.resize(a_xloc.size());
+    d_yloc.resize(a_yloc.size());
+    Gpu::copy(Gpu::hostToDevice, a_xloc.begin(), a_xloc.end(), d_xloc.begin());
+    Gpu::copy(Gpu::hostToDevice, a_yloc.begin(), a_yloc.end(), d_yloc.begin());
+}
+
+void
+GeneralAD::set_blade_spec (const Vector<Real>& a_bld_rad_loc,
+                           const Vector<Real>& a_bld_twist,
+                           const Vector<Real>& a_bld_chord)
+{
+    NullWindFarm::set_blade_spec(a_bld_rad_loc, a_bld_twist, a_bld_chord);
+
+    d_bld_rad_loc.resize(a_bld_rad_loc.size());
+    d_bld_twist.resize(a_bld_twist.size());
+    d_bld_chord.resize(a_bld_chord.size());
+    Gpu::copy(Gpu::hostToDevice, a_bld_rad_loc.begin(), a_bld_rad_loc.end(), d_bld_rad_loc.begin());
+    Gpu::copy(Gpu::hostToDevice, a_bld_twist.begin(), a_bld_twist.end(), d_bld_twist.begin());
+    Gpu::copy(Gpu::hostToDevice, a_bld_chord.begin(), a_bld_chord.end(), d_bld_chord.begin());
+}
 
+void
+GeneralAD::set_blade_airfoil_spec (const Vector<Vector<Real>>& a_bld_airfoil_aoa,
+                                   const Vector<Vector<Real>>& a_bld_airfoil_Cl,
+                                   const Vector<Vector<Real>>& a_bld_airfoil_Cd)
+{
+    NullWindFarm::set_blade_airfoil_spec(a_bld_airfoil_aoa, a_bld_airfoil_Cl, a_bld_airfoil_Cd);
+
+    // Flatten the per-section tables into contiguous arrays
+    int n_sections = a_bld_airfoil_aoa.size();
+    Vector<int>  offsets(n_sections+1, 0);
+    Vector<Real> aoa_flat, Cl_flat, Cd_flat;
+    for (int n = 0; n < n_sections; ++n) {
+        AMREX_ALWAYS_ASSERT(a_bld_airfoil_Cl[n].size() == a_bld_airfoil_aoa[n].size() &&
+                            a_bld_airfoil_Cd[n].size() == a_bld_airfoil_aoa[n].size());
+        offsets[n+1] = offsets[n] + a_bld_airfoil_aoa[n].size();
+        aoa_flat.insert(aoa_flat.end(), a_bld_airfoil_aoa[n].begin(), a_bld_airfoil_aoa[n].end());
+        Cl_flat.insert (Cl_flat.end() , a_bld_airfoil_Cl[n].begin() , a_bld_airfoil_Cl[n].end());
+        Cd_flat.insert (Cd_flat.end() , a_bld_airfoil_Cd[n].begin() , a_bld_airfoil_Cd[n].end());
     }
+
+    d_airfoil_offsets.resize(offsets.size());
+    d_airfoil_aoa.resize(aoa_flat.size());
+    d_airfoil_Cl.resize(Cl_flat.size());
+    d_airfoil_Cd.resize(Cd_flat.size());
+    Gpu::copy(Gpu::hostToDevice, offsets.begin(), offsets.end(), d_airfoil_offsets.begin());
+    Gpu::copy(Gpu::hostToDevice, aoa_flat.begin(), aoa_flat.end(), d_airfoil_aoa.begin());
+    Gpu::copy(Gpu::hostToDevice, Cl_flat.begin(), Cl_flat.end(), d_airfoil_Cl.begin());
+    Gpu::copy(Gpu::hostToDevice, Cd_flat.begin(), Cd_flat.end(), d_airfoil_Cd.begin());
+}
+
+void
+GeneralAD::set_turb_spec_extra (const Vector<Real>& a_velocity,
+                                const Vector<Real>& a_C_P,
+                                const Vector<Real>& a_C_T,
+                                const Vector<Real>& a_rotor_RPM,
+                                const Vector<Real>& a_blade_pitch)
+{
+    NullWindFarm::set_turb_spec_extra(a_velocity, a_C_P, a_C_T, a_rotor_RPM, a_blade_pitch);
+
+    d_velocity.resize(a_velocity.size());
+    d_rotor_RPM.resize(a_rotor_RPM.size());
+    d_blade_pitch.resize(a_blade_pitch.size());
+    Gpu::copy(Gpu::hostToDevice, a_velocity.begin(), a_velocity.end(), d_velocity.begin());
+    Gpu::copy(Gpu::hostToDevice, a_rotor_RPM.begin(), a_rotor_RPM.end(), d_rotor_RPM.begin());
+    Gpu::copy(Gpu::hostToDevice, a_blade_pitch.begin(), a_blade_pitch.end(), d_blade_pitch.begin());
 }
 
 void GeneralAD::compute_freestream_velocity(const MultiFab& cons_in,
@@ -87,6 +162,7 @@ void GeneralAD::compute_freestream_velocity(const MultiFab& cons_in,
 
 
      for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         auto SMark_array    = mf_SMark.array(mfi);
         auto u_vel          = U_old.array(mfi);
@@ -103,6 +179,7 @@ void GeneralAD::compute_freestream_velocity(const MultiFab& cons_in,
                 Gpu::Atomic::Add(&d_freestream_phi_ptr[turb_index],phi);
             }
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
 
     // Copy back to host
@@ -143,30 +220,26 @@ int find_rad_loc_index(const Real rad,
                        const Real* bld_rad_loc,
                        const int n_bld_sections)
 {
-      // Find the index of the radial location
-    int index=-1;
+    // Find the index of the radial location, i.e. the first section whose
+    // radial location is beyond rad (or the last section)
     Real rhub = 2.0;
     Real rad_from_hub = rad - rhub;
     if(rad_from_hub < 0.0) {
-        index = 0;
+        return 0;
     }
-    else {
-        for(int i=0;i<n_bld_sections;i++){
-            if(bld_rad_loc[i] > rad) {
-                index = i;
-                break;
-            }
+
+    int lo = 0;
+    int hi = n_bld_sections;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (bld_rad_loc[mid] > rad) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
         }
     }
-    if(index == -1 and rad > bld_rad_loc[n_bld_sections-1]) {
-        index = n_bld_sections-1;
-    }
-    if(index == -1) {
-        //printf("The radial section is at %0.15g m\n",rad);
-        Abort("Could not find index of the radial section.");
-    }
 
-    return index;
+    return amrex::min(lo, n_bld_sections-1);
 }
 
 AMREX_FORCE_INLINE
@@ -188,8 +261,8 @@ compute_source_terms_Fn_Ft (const Real rad,
                             const int n_spec_extra)
 {
 
-    Real rpm = interpolate_1d(velocity, rotor_RPM, avg_vel, n_spec_extra);
-    Real pitch = interpolate_1d(velocity, blade_pitch, avg_vel, n_spec_extra);
+    Real rpm = interpolate_1d_bsearch(velocity, rotor_RPM, avg_vel, n_spec_extra);
+    Real pitch = interpolate_1d_bsearch(velocity, blade_pitch, avg_vel, n_spec_extra);
 
     Real Omega = rpm/60.0*2.0*PI;
     Real rho = 1.226;
@@ -198,8 +271,8 @@ compute_source_terms_Fn_Ft (const Real rad,
     Real rhub = 2.0;
     Real rtip = 63.5;
 
-    Real twist = interpolate_1d(bld_rad_loc, bld_twist, rad, n_bld_sections);
-    Real c = interpolate_1d(bld_rad_loc, bld_chord, rad, n_bld_sections);
+    Real twist = interpolate_1d_bsearch(bld_rad_loc, bld_twist, rad, n_bld_sections);
+    Real c = interpolate_1d_bsearch(bld_rad_loc, bld_chord, rad, n_bld_sections);
 
     // Iteration procedure
 
@@ -222,8 +295,8 @@ compute_source_terms_Fn_Ft (const Real rad,
 
         Real aoa = psi*180.0/PI - twist + pitch;
 
-        Cl = interpolate_1d(bld_airfoil_aoa, bld_airfoil_Cl, aoa, n_pts_airfoil);
-        Cd = interpolate_1d(bld_airfoil_aoa, bld_airfoil_Cd, aoa, n_pts_airfoil);
+        Cl = interpolate_1d_bsearch(bld_airfoil_aoa, bld_airfoil_Cl, aoa, n_pts_airfoil);
+        Cd = interpolate_1d_bsearch(bld_airfoil_aoa, bld_airfoil_Cd, aoa, n_pts_airfoil);
 
         //Cl = 1.37;
         //Cd = 0.014;
@@ -287,26 +360,14 @@ GeneralAD::source_terms_cellcentered (const Geometry& geom,
                                      const MultiFab& mf_SMark,
                                      MultiFab& mf_vars_generalAD)
 {
-
-    get_turb_loc(xloc, yloc);
+    BL_PROFILE("GeneralAD::source_terms_cellcentered()");
 
     get_turb_spec(rotor_rad, hub_height, thrust_coeff_standing,
                   wind_speed, thrust_coeff, power);
 
-    get_blade_spec(bld_rad_loc,bld_twist,bld_chord);
-
-    get_blade_airfoil_spec(bld_airfoil_aoa, bld_airfoil_Cl, bld_airfoil_Cd);
-
-    get_turb_spec_extra(velocity, C_P, C_T, rotor_RPM, blade_pitch);
-
     Real d_hub_height = hub_height;
     Real d_rotor_rad = rotor_rad;
 
-    Gpu::DeviceVector<Real> d_xloc(xloc.size());
-    Gpu::DeviceVector<Real> d_yloc(yloc.size());
-    Gpu::copy(Gpu::hostToDevice, xloc.begin(), xloc.end(), d_xloc.begin());
-    Gpu::copy(Gpu::hostToDevice, yloc.begin(), yloc.end(), d_yloc.begin());
-
       auto dx = geom.CellSizeArray();
 
   // Domain valid box
@@ -330,79 +391,37 @@ GeneralAD::source_terms_cellcentered (const Geometry& geom,
     get_turb_disk_angle(turb_disk_angle);
     Real d_turb_disk_angle = turb_disk_angle;
 
+    // Only the freestream data changes from step to step; the turbine and blade
+    // tables were uploaded to the device when they were set
     Gpu::DeviceVector<Real> d_freestream_velocity(nturbs);
     Gpu::DeviceVector<Real> d_disk_cell_count(nturbs);
     Gpu::copy(Gpu::hostToDevice, freestream_velocity.begin(), freestream_velocity.end(), d_freestream_velocity.begin());
     Gpu::copy(Gpu::hostToDevice, disk_cell_count.begin(), disk_cell_count.end(), d_disk_cell_count.begin());
 
-    Real* d_xloc_ptr = d_xloc.data();
-    Real* d_yloc_ptr = d_yloc.data();
+    const Real* d_xloc_ptr = d_xloc.data();
+    const Real* d_yloc_ptr = d_yloc.data();
     Real* d_freestream_velocity_ptr = d_freestream_velocity.data();
     Real* d_disk_cell_count_ptr     = d_disk_cell_count.data();
 
-    int n_bld_sections = bld_rad_loc.size();
-
-    Gpu::DeviceVector<Real>    d_bld_rad_loc(n_bld_sections);
-    Gpu::DeviceVector<Real>    d_bld_twist(n_bld_sections);
-    Gpu::DeviceVector<Real>    d_bld_chord(n_bld_sections);
-
-    Gpu::copy(Gpu::hostToDevice, bld_rad_loc.begin(), bld_rad_loc.end(), d_bld_rad_loc.begin());
-    Gpu::copy(Gpu::hostToDevice, bld_twist.begin(), bld_twist.end(), d_bld_twist.begin());
-    Gpu::copy(Gpu::hostToDevice, bld_chord.begin(), bld_chord.end(), d_bld_chord.begin());
-
-    Real* bld_rad_loc_ptr = d_bld_rad_loc.data();
-    Real* bld_twist_ptr = d_bld_twist.data();
-    Real* bld_chord_ptr = d_bld_chord.data();
-
-    Vector<Gpu::DeviceVector<Real>> d_bld_airfoil_aoa(n_bld_sections);
-    Vector<Gpu::DeviceVector<Real>> d_bld_airfoil_Cl(n_bld_sections);
-    Vector<Gpu::DeviceVector<Real>> d_bld_airfoil_Cd(n_bld_sections);
-
-    int n_pts_airfoil = bld_airfoil_aoa[0].size();
+    int n_bld_sections = d_bld_rad_loc.size();
 
-    for(int i=0;i<n_bld_sections;i++){
-        d_bld_airfoil_aoa[i].resize(n_pts_airfoil);
-        d_bld_airfoil_Cl[i].resize(n_pts_airfoil);
-        d_bld_airfoil_Cd[i].resize(n_pts_airfoil);
-        Gpu::copy(Gpu::hostToDevice, bld_airfoil_aoa[i].begin(), bld_airfoil_aoa[i].end(), d_bld_airfoil_aoa[i].begin());
-        Gpu::copy(Gpu::hostToDevice, bld_airfoil_Cl[i].begin(), bld_airfoil_Cl[i].end(), d_bld_airfoil_Cl[i].begin());
-        Gpu::copy(Gpu::hostToDevice, bld_airfoil_Cd[i].begin(), bld_airfoil_Cd[i].end(), d_bld_airfoil_Cd[i].begin());
-    }
-
-    Vector<Real*> hp_bld_airfoil_aoa, hp_bld_airfoil_Cl, hp_bld_airfoil_Cd;
-    for (auto & v :d_bld_airfoil_aoa) {
-        hp_bld_airfoil_aoa.push_back(v.data());
-    }
-    for (auto & v :d_bld_airfoil_Cl) {
-        hp_bld_airfoil_Cl.push_back(v.data());
-    }
-    for (auto & v :d_bld_airfoil_Cd) {
-        hp_bld_airfoil_Cd.push_back(v.data());
-    }
-
-    Gpu::AsyncArray<Real*> aoa(hp_bld_airfoil_aoa.data(), n_bld_sections);
-    Gpu::AsyncArray<Real*> Cl(hp_bld_airfoil_Cl.data(), n_bld_sections);
-    Gpu::AsyncArray<Real*> Cd(hp_bld_airfoil_Cd.data(), n_bld_sections);
+    const Real* bld_rad_loc_ptr = d_bld_rad_loc.data();
+    const Real* bld_twist_ptr   = d_bld_twist.data();
+    const Real* bld_chord_ptr   = d_bld_chord.data();
 
-    auto d_bld_airfoil_aoa_ptr = aoa.data();
-    auto d_bld_airfoil_Cl_ptr  = Cl.data();
-    auto d_bld_airfoil_Cd_ptr  = Cd.data();
+    const int*  airfoil_offsets_ptr = d_airfoil_offsets.data();
+    const Real* airfoil_aoa_ptr     = d_airfoil_aoa.data();
+    const Real* airfoil_Cl_ptr      = d_airfoil_Cl.data();
+    const Real* airfoil_Cd_ptr      = d_airfoil_Cd.data();
 
-    int n_spec_extra = velocity.size();
+    int n_spec_extra = d_velocity.size();
 
-    Gpu::DeviceVector<Real> d_velocity(n_spec_extra);
-    Gpu::DeviceVector<Real> d_rotor_RPM(n_spec_extra);
-    Gpu::DeviceVector<Real> d_blade_pitch(n_spec_extra);
-
-    Gpu::copy(Gpu::hostToDevice, velocity.begin(), velocity.end(), d_velocity.begin());
-    Gpu::copy(Gpu::hostToDevice, rotor_RPM.begin(), rotor_RPM.end(), d_rotor_RPM.begin());
-    Gpu::copy(Gpu::hostToDevice, blade_pitch.begin(), blade_pitch.end(), d_blade_pitch.begin());
-
-    auto d_velocity_ptr = d_velocity.data();
-    auto d_rotor_RPM_ptr = d_rotor_RPM.data();
-    auto d_blade_pitch_ptr = d_blade_pitch.data();
+    const Real* d_velocity_ptr    = d_velocity.data();
+    const Real* d_rotor_RPM_ptr   = d_rotor_RPM.data();
+    const Real* d_blade_pitch_ptr = d_blade_pitch.data();
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         const Box& gbx      = mfi.growntilebox(1);
         auto SMark_array    = mf_SMark.array(mfi);
@@ -419,81 +438,76 @@ GeneralAD::source_terms_cellcentered (const Geometry& geom,
             // ?? Density needed here
             Real inv_dens_vol = 1.0/(1.0*dx[0]*dx[1]*dx[2]);
 
-            int check_int = 0;
-
             Real source_x = 0.0, source_y = 0.0, source_z = 0.0;
             std::array<Real,2> Fn_and_Ft;
 
-            for(long unsigned int it=0;it<nturbs;it++) {
-                 Real avg_vel  = d_freestream_velocity_ptr[it]/(d_disk_cell_count_ptr[it] + 1e-10);
-                 Real phi = d_turb_disk_angle;
-
-                // This if check makes sure it is a point on the actuator disk
-                if(SMark_array(ii,jj,kk,1) == static_cast<double>(it)) {
-                    check_int++;
-
-                    // Find radial distance of the point and the zeta angle
-                    Real rad = std::pow( (x-d_xloc_ptr[it])*(x-d_xloc_ptr[it]) +
-                                         (y-d_yloc_ptr[it])*(y-d_yloc_ptr[it]) +
-                                         (z-d_hub_height)*(z-d_hub_height), 0.5 );
-
-                    int index = find_rad_loc_index(rad, bld_rad_loc_ptr, n_bld_sections);
-
-                    // This if check makes sure it is a point with radial distance
-                    // between the hub radius and the rotor radius.
-                    // ?? hub radius needed here
-                    if(rad >= 2.0 and rad <= d_rotor_rad) {
-                        //AMREX_ASSERT( (z-d_hub_height) <= rad );
-                        // Consider the vector that joines the point and the turbine center.
-                        // Dot it on to the vector that joins the turbine center and along
-                        // the plane of the disk. See fig. 10 in Mirocha et. al. 2014.
-
-                        Real vec_proj = (x-d_xloc_ptr[it])*(std::sin(phi)) +
-                                        (y-d_yloc_ptr[it])*(-std::cos(phi));
-
-
-                        Real zeta = std::atan2(z-d_hub_height, vec_proj);
-                        //printf("zeta val is %0.15g\n", zeta*180.0/PI);
-                        Fn_and_Ft = compute_source_terms_Fn_Ft(rad, avg_vel,
-                                                               bld_rad_loc_ptr,
-                                                               bld_twist_ptr,
-                                                               bld_chord_ptr,
-                                                               n_bld_sections,
-                                                               d_bld_airfoil_aoa_ptr[index],
-                                                               d_bld_airfoil_Cl_ptr[index],
-                                                               d_bld_airfoil_Cd_ptr[index],
-                                                               n_pts_airfoil,
-                                                               d_velocity_ptr,
-                                                               d_rotor_RPM_ptr,
-                                                               d_blade_pitch_ptr,
-                                                               n_spec_extra);
-
-                        Real Fn = Fn_and_Ft[0];
-                        Real Ft = Fn_and_Ft[1];
-                        // Compute the source terms - pass in radial distance, free stream velocity
-
-                        Real Fx = Fn*std::cos(phi) + Ft*std::sin(zeta)*std::sin(phi);
-                        Real Fy = Fn*std::sin(phi) - Ft*std::sin(zeta)*std::cos(phi);
-                        Real Fz = -Ft*std::cos(zeta);
-
-                        source_x = -Fx*inv_dens_vol;
-                        source_y = -Fy*inv_dens_vol;
-                        source_z = -Fz*inv_dens_vol;
-
-
-                        //printf("Val source_x, is %0.15g, %0.15g, %0.15g %0.15g %0.15g %0.15g\n", rad, Fn, Ft, source_x, source_y, source_z);
-                    }
+            // SMark holds the index of the disk this cell belongs to (the last one if disks overlap), or -1
+            int it = static_cast<int>(SMark_array(ii,jj,kk,1));
+
+            // This if check makes sure it is a point on the actuator disk
+            if (it >= 0) {
+                Real avg_vel  = d_freestream_velocity_ptr[it]/(d_disk_cell_count_ptr[it] + 1e-10);
+                Real phi = d_turb_disk_angle;
+
+                // Find radial distance of the point and the zeta angle
+                Real rad = std::pow( (x-d_xloc_ptr[it])*(x-d_xloc_ptr[it]) +
+                                     (y-d_yloc_ptr[it])*(y-d_yloc_ptr[it]) +
+                                     (z-d_hub_height)*(z-d_hub_height), 0.5 );
+
+                int index = find_rad_loc_index(rad, bld_rad_loc_ptr, n_bld_sections);
+
+                // This if check makes sure it is a point with radial distance
+                // between the hub radius and the rotor radius.
+                // ?? hub radius needed here
+                if(rad >= 2.0 and rad <= d_rotor_rad) {
+                    //AMREX_ASSERT( (z-d_hub_height) <= rad );
+                    // Consider the vector that joines the point and the turbine center.
+                    // Dot it on to the vector that joins the turbine center and along
+                    // the plane of the disk. See fig. 10 in Mirocha et. al. 2014.
+
+                    Real vec_proj = (x-d_xloc_ptr[it])*(std::sin(phi)) +
+                                    (y-d_yloc_ptr[it])*(-std::cos(phi));
+
+
+                    Real zeta = std::atan2(z-d_hub_height, vec_proj);
+                    //printf("zeta val is %0.15g\n", zeta*180.0/PI);
+                    const int off = airfoil_offsets_ptr[index];
+                    const int n_pts_airfoil = airfoil_offsets_ptr[index+1] - off;
+                    Fn_and_Ft = compute_source_terms_Fn_Ft(rad, avg_vel,
+                                                           bld_rad_loc_ptr,
+                                                           bld_twist_ptr,
+                                                           bld_chord_ptr,
+                                                           n_bld_sections,
+                                                           airfoil_aoa_ptr + off,
+                                                           airfoil_Cl_ptr  + off,
+                                                           airfoil_Cd_ptr  + off,
+                                                           n_pts_airfoil,
+                                                           d_velocity_ptr,
+                                                           d_rotor_RPM_ptr,
+                                                           d_blade_pitch_ptr,
+                                                           n_spec_extra);
+
+                    Real Fn = Fn_and_Ft[0];
+                    Real Ft = Fn_and_Ft[1];
+                    // Compute the source terms - pass in radial distance, free stream velocity
+
+                    Real Fx = Fn*std::cos(phi) + Ft*std::sin(zeta)*std::sin(phi);
+                    Real Fy = Fn*std::sin(phi) - Ft*std::sin(zeta)*std::cos(phi);
+                    Real Fz = -Ft*std::cos(zeta);
+
+                    source_x = -Fx*inv_dens_vol;
+                    source_y = -Fy*inv_dens_vol;
+                    source_z = -Fz*inv_dens_vol;
+
+
+                    //printf("Val source_x, is %0.15g, %0.15g, %0.15g %0.15g %0.15g %0.15g\n", rad, Fn, Ft, source_x, source_y, source_z);
                 }
             }
 
-            if(check_int > 1){
-                amrex::Error("Actuator disks are overlapping. Visualize actuator_disks.vtk "
-                             "and check the windturbine locations input file. Exiting..");
-            }
-
             generalAD_array(i,j,k,0) = source_x;
             generalAD_array(i,j,k,1) = source_y;
             generalAD_array(i,j,k,2) = source_z;
          });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }
@@ -30,6 +30,7 @@ SimpleAD::update (const Real& dt_advance,
 {
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         Box tbx = mfi.nodaltilebox(0);
         Box tby = mfi.nodaltilebox(1);
@@ -47,6 +48,7 @@ SimpleAD::update (const Real& dt_advance,
         {
             v_vel(i,j,k) = v_vel(i,j,k) + (simpleAD_array(i,j-1,k,1) + simpleAD_array(i,j,k,1))/2.0*dt_advance;
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }
 
@@ -76,6 +78,7 @@ void SimpleAD::compute_freestream_velocity(const MultiFab& cons_in,
 
 
      for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         auto SMark_array    = mf_SMark.array(mfi);
         auto u_vel          = U_old.array(mfi);
@@ -92,6 +95,7 @@ void SimpleAD::compute_freestream_velocity(const MultiFab& cons_in,
                 Gpu::Atomic::Add(&d_freestream_phi_ptr[turb_index],phi);
             }
         });
+        box_cost_stop(m_cost, mfi, wt);
     }
 
     // Copy back to host
@@ -131,6 +135,7 @@ SimpleAD::source_terms_cellcentered (const Geometry& geom,
                                      const MultiFab& mf_SMark,
                                      MultiFab& mf_vars_simpleAD)
 {
+    BL_PROFILE("SimpleAD::source_terms_cellcentered()");
 
     get_turb_loc(xloc, yloc);
     get_turb_spec(rotor_rad, hub_height, thrust_coeff_standing,
@@ -185,6 +190,7 @@ SimpleAD::source_terms_cellcentered (const Geometry& geom,
     const int n_spec_table = d_wind_speed.size();
 
     for ( MFIter mfi(cons_in,TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        Real wt = box_cost_start(m_cost);
 
         const Box& gbx      = mfi.growntilebox(1);
         auto SMark_array    = mf_SMark.array(mfi);
@@ -195,40 +201,32 @@ SimpleAD::source_terms_cellcentered (const Geometry& geom,
             int jj = amrex::min(amrex::max(j, domlo_y), domhi_y);
             int kk = amrex::min(amrex::max(k, domlo_z), domhi_z);
 
-            int check_int = 0;
-
             Real source_x = 0.0;
             Real source_y = 0.0;
 
-            for(long unsigned int it=0;it<nturbs;it++) {
+            // SMark holds the index of the disk this cell belongs to (the last one if disks overlap), or -1
+            int it = static_cast<int>(SMark_array(ii,jj,kk,1));
+
+            if (it >= 0) {
                 Real avg_vel  = d_freestream_velocity_ptr[it]/(d_disk_cell_count_ptr[it] + 1e-10);
                 Real phi      = d_freestream_phi_ptr[it]/(d_disk_cell_count_ptr[it] + 1e-10);
 
                 Real C_T = interpolate_1d(wind_speed_d, thrust_coeff_d, avg_vel, n_spec_table);
-                Real a;
+                Real Uinfty_dot_nhat = avg_vel*(std::cos(phi)*nx + std::sin(phi)*ny);
                 if(C_T <= 1) {
-                    a = 0.5 - 0.5*std::pow(1.0-C_T,0.5);
+                    Real a = 0.5 - 0.5*std::pow(1.0-C_T,0.5);
+                    source_x = -2.0*std::pow(Uinfty_dot_nhat, 2.0)*a*(1.0-a)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::cos(phi);
+                    source_y = -2.0*std::pow(Uinfty_dot_nhat, 2.0)*a*(1.0-a)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::sin(phi);
                 }
-                Real Uinfty_dot_nhat = avg_vel*(std::cos(phi)*nx + std::sin(phi)*ny);
-                if(SMark_array(ii,jj,kk,1) == static_cast<double>(it)) {
-                    check_int++;
-                    if(C_T <= 1) {
-                        source_x = -2.0*std::pow(Uinfty_dot_nhat, 2.0)*a*(1.0-a)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::cos(phi);
-                        source_y = -2.0*std::pow(Uinfty_dot_nhat, 2.0)*a*(1.0-a)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::sin(phi);
-                    }
-                    else {
-                        source_x = -0.5*C_T*std::pow(Uinfty_dot_nhat, 2.0)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::cos(phi);
-                        source_y = -0.5*C_T*std::pow(Uinfty_dot_nhat, 2.0)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::sin(phi);
-                    }
+                else {
+                    source_x = -0.5*C_T*std::pow(Uinfty_dot_nhat, 2.0)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::cos(phi);
+                    source_y = -0.5*C_T*std::pow(Uinfty_dot_nhat, 2.0)*dx[1]*dx[2]*std::cos(d_turb_disk_angle)/(dx[0]*dx[1]*dx[2])*std::sin(phi);
                 }
             }
-            if(check_int > 1){
-                amrex::Error("Actuator disks are overlapping. Visualize actuator_disks.vtk "
-                             "and check the windturbine locations input file. Exiting..");
-            }
 
             simpleAD_array(i,j,k,0) = source_x;
             simpleAD_array(i,j,k,1) = source_y;
          });
+        box_cost_stop(m_cost, mfi, wt);
     }
 }